@@ -0,0 +1,263 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace hft::core {
+
+    /**
+     * @brief What the writer does when the slowest reader is a full ring behind
+     */
+    enum class OverflowPolicy {
+        BACKPRESSURE,  // try_claim() fails until the slowest reader catches up
+        OVERWRITE,     // Writer never waits; readers that fall behind are lapped
+    };
+
+    /**
+     * @brief Result of a reader poll
+     */
+    enum class ReadStatus {
+        OK,      // Handler was called for one or more events
+        EMPTY,   // Reader is caught up with the writer
+        LAPPED,  // (OVERWRITE only) Writer overran the reader; cursor resynced to live
+    };
+
+    /**
+     * @brief Single-writer, multi-reader broadcast ring (Disruptor pattern)
+     *
+     * One book builder publishes each event once; every registered reader
+     * (strategy, logger, risk) sees every event, at its own pace, reading it
+     * in place in the ring - no per-reader queue and no copy.
+     *
+     * - The writer owns a single cursor (published_); readers never write it.
+     * - Each reader owns a sequence cursor on its own cache line; the writer
+     *   only reads them (BACKPRESSURE), and caches their minimum so it
+     *   rescans only when the cached minimum says the ring is full.
+     * - Sequences are free-running 64-bit counters; slot = sequence & mask.
+     *
+     * OVERWRITE mode: the writer announces each slot it is about to reuse
+     * (claimed_) before touching it, seqlock-style. A reader validates after
+     * handling an event that the slot was not reclaimed meanwhile; if it was,
+     * the read reports LAPPED and the reader jumps to the live edge.
+     * Handlers may then observe a torn event and must not act on it before
+     * read() returns OK, so T must be trivially copyable in this mode.
+     *
+     * Thread Safety: one writer thread; each reader id used by one thread.
+     *
+     * @tparam T Event type
+     * @tparam Capacity Number of slots (must be power of 2)
+     * @tparam MaxReaders Maximum simultaneously registered readers
+     * @tparam Policy Overflow behaviour
+     *
+     * Example usage:
+     * @code
+     * BroadcastRing<BookEvent, 4096, 4, OverflowPolicy::BACKPRESSURE> ring;
+     * auto strategy = *ring.add_reader();
+     * auto logger = *ring.add_reader();
+     *
+     * // Writer thread
+     * if (BookEvent* slot = ring.try_claim()) {
+     *     *slot = event;
+     *     ring.publish();
+     * }
+     *
+     * // Strategy thread
+     * ring.read(strategy, [](const BookEvent& e, uint64_t seq) { on_event(e); });
+     * @endcode
+     */
+    template<typename T, size_t Capacity, size_t MaxReaders,
+             OverflowPolicy Policy = OverflowPolicy::BACKPRESSURE>
+    class BroadcastRing {
+    public:
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+            "Capacity must be power of 2 for optimal performance (enables bit masking)");
+        static_assert(MaxReaders > 0, "BroadcastRing needs at least one reader slot");
+        static_assert(Policy != OverflowPolicy::OVERWRITE || std::is_trivially_copyable_v<T>,
+            "OVERWRITE readers may observe a slot mid-write: T must be trivially copyable");
+
+        static constexpr size_t INDEX_MASK = Capacity - 1;
+        static constexpr size_t MAX_BATCH = Capacity;
+
+        BroadcastRing() noexcept = default;
+        BroadcastRing(const BroadcastRing&) = delete;
+        BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+        // ------------------------------------------------------------------
+        // Reader registration (setup path)
+        // ------------------------------------------------------------------
+
+        /**
+         * @brief Register a reader starting at the live edge
+         * @return Reader id, or std::nullopt if all MaxReaders slots are taken
+         */
+        [[nodiscard]] std::optional<size_t> add_reader() noexcept {
+            for (size_t id = 0; id < MaxReaders; ++id) {
+                bool expected = false;
+                if (readers_[id].active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    // A reader joining at published_ cannot lower the writer's
+                    // minimum, so a stale cached minimum stays safe
+                    readers_[id].sequence.store(published_.load(std::memory_order_acquire),
+                                                std::memory_order_release);
+                    readers_[id].lapped.store(0, std::memory_order_relaxed);
+                    return id;
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// Unregister a reader; the writer stops waiting for it
+        void remove_reader(size_t id) noexcept {
+            readers_[id].active.store(false, std::memory_order_release);
+        }
+
+        // ------------------------------------------------------------------
+        // Writer
+        // ------------------------------------------------------------------
+
+        /**
+         * @brief Claim the next slot to construct an event in place
+         *
+         * @return Slot to write, or nullptr if (BACKPRESSURE) the slowest
+         *         reader is a full ring behind. Never nullptr in OVERWRITE mode.
+         *         Invisible to readers until publish().
+         */
+        [[nodiscard]] T* try_claim() noexcept {
+            const uint64_t next = published_.load(std::memory_order_relaxed);
+
+            if constexpr (Policy == OverflowPolicy::BACKPRESSURE) {
+                if (next - cached_min_reader_ >= Capacity) {
+                    cached_min_reader_ = min_reader_sequence(next);
+                    if (next - cached_min_reader_ >= Capacity) {
+                        return nullptr;  // Slowest reader still holds this slot
+                    }
+                }
+            } else {
+                // Announce the slot reuse before writing it (seqlock writer side)
+                claimed_.store(next + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+            return &slots_[next & INDEX_MASK];
+        }
+
+        /// Make the slot returned by try_claim() visible to all readers
+        void publish() noexcept {
+            published_.store(published_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /// Copy-in convenience: try_claim() + publish()
+        [[nodiscard]] bool try_publish(const T& event) noexcept {
+            T* slot = try_claim();
+            if (slot == nullptr) {
+                return false;
+            }
+            *slot = event;
+            publish();
+            return true;
+        }
+
+        // ------------------------------------------------------------------
+        // Readers
+        // ------------------------------------------------------------------
+
+        /**
+         * @brief Hand up to `max_events` available events to `handler` in place
+         *
+         * Calls handler(const T&, uint64_t sequence) for each event, then
+         * advances this reader's cursor once for the whole batch.
+         *
+         * @return OK / EMPTY, or LAPPED if (OVERWRITE) the writer overran this
+         *         reader; events handled in that call must be discarded
+         */
+        template<typename Handler>
+        ReadStatus read(size_t id, Handler&& handler, size_t max_events = MAX_BATCH) noexcept {
+            ReaderCursor& reader = readers_[id];
+            const uint64_t start = reader.sequence.load(std::memory_order_relaxed);
+            const uint64_t available = published_.load(std::memory_order_acquire) - start;
+            if (available == 0) {
+                return ReadStatus::EMPTY;
+            }
+
+            if constexpr (Policy == OverflowPolicy::OVERWRITE) {
+                if (available > Capacity) {
+                    return resync(reader, start);
+                }
+            }
+
+            const uint64_t count = available < max_events ? available : max_events;
+            for (uint64_t seq = start; seq < start + count; ++seq) {
+                handler(static_cast<const T&>(slots_[seq & INDEX_MASK]), seq);
+            }
+
+            if constexpr (Policy == OverflowPolicy::OVERWRITE) {
+                // Seqlock reader side: were any of those slots reclaimed meanwhile?
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (claimed_.load(std::memory_order_relaxed) - start > Capacity) {
+                    return resync(reader, start);
+                }
+            }
+
+            reader.sequence.store(start + count, std::memory_order_release);
+            return ReadStatus::OK;
+        }
+
+        /// Events published but not yet read by this reader
+        [[nodiscard]] uint64_t lag(size_t id) const noexcept {
+            return published_.load(std::memory_order_acquire) -
+                   readers_[id].sequence.load(std::memory_order_relaxed);
+        }
+
+        /// Events this reader lost to the writer (OVERWRITE mode)
+        [[nodiscard]] uint64_t lapped_events(size_t id) const noexcept {
+            return readers_[id].lapped.load(std::memory_order_relaxed);
+        }
+
+        /// Total events published
+        [[nodiscard]] uint64_t published() const noexcept {
+            return published_.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct alignas(64) ReaderCursor {
+            std::atomic<uint64_t> sequence{ 0 };  // Next sequence this reader will read
+            std::atomic<bool> active{ false };
+            std::atomic<uint64_t> lapped{ 0 };    // Events skipped after being lapped
+        };
+
+        /// Lowest cursor among active readers (writer only)
+        uint64_t min_reader_sequence(uint64_t next) const noexcept {
+            uint64_t min_seq = next;
+            for (const auto& reader : readers_) {
+                if (reader.active.load(std::memory_order_acquire)) {
+                    const uint64_t seq = reader.sequence.load(std::memory_order_acquire);
+                    min_seq = seq < min_seq ? seq : min_seq;
+                }
+            }
+            return min_seq;
+        }
+
+        /// Jump a lapped reader to the live edge and account for what it lost
+        ReadStatus resync(ReaderCursor& reader, uint64_t from) noexcept {
+            const uint64_t live = published_.load(std::memory_order_acquire);
+            reader.lapped.fetch_add(live - from, std::memory_order_relaxed);
+            reader.sequence.store(live, std::memory_order_release);
+            return ReadStatus::LAPPED;
+        }
+
+        alignas(64) std::array<T, Capacity> slots_{};
+
+        // Writer cursor: count of published events (next sequence to write)
+        alignas(64) std::atomic<uint64_t> published_{ 0 };
+
+        // OVERWRITE: highest sequence + 1 whose slot the writer has started reusing
+        alignas(64) std::atomic<uint64_t> claimed_{ 0 };
+
+        // Writer-local cache of the slowest reader's cursor
+        alignas(64) uint64_t cached_min_reader_{ 0 };
+
+        std::array<ReaderCursor, MaxReaders> readers_{};
+    };
+
+} // namespace hft::core
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "backing_memory.hpp"  // 03_memory_pool: MappedRegion does the mbind()
+#include "numa_topology.hpp"   // 03_memory_pool: CPU -> node lookup
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace hft::core {
+
+    /// No binding: pages land on the node of the thread that first touches them
+    using memory::ANY_NUMA_NODE;
+
+    /**
+     * @brief NUMA node of the CPU the calling thread is running on
+     *
+     * Only stable once the thread is pinned. Returns ANY_NUMA_NODE if the
+     * CPU is unknown (see memory::Topology::system()).
+     */
+    inline int current_numa_node() {
+        return memory::Topology::system().current_node();
+    }
+
+    /**
+     * @brief NUMA node that `cpu` belongs to
+     * @return ANY_NUMA_NODE if the CPU does not exist
+     */
+    inline int numa_node_of_cpu(unsigned cpu) {
+        return memory::Topology::system().node_of_cpu(static_cast<int>(cpu));
+    }
+
+    /**
+     * @brief Deleter for objects created by make_on_node()
+     */
+    template<typename T>
+    struct NodeLocalDeleter {
+        void operator()(T* object) const noexcept {
+            object->~T();
+            memory::MappedRegion::unmap(object, sizeof(T));
+        }
+    };
+
+    template<typename T>
+    using NodeLocalPtr = std::unique_ptr<T, NodeLocalDeleter<T>>;
+
+    /**
+     * @brief Construct a T whose memory is placed on NUMA node `node`
+     *
+     * For in-place structures such as RingBuffer, whose storage is a member
+     * array: the object gets its own mapping, mbind()-ed to `node` before
+     * the constructor first touches it. Without this the ring lands on the
+     * node of whichever thread constructed it - often main(), not the
+     * producer or consumer - and on a dual-socket machine every access from
+     * the other socket pays remote-memory latency.
+     *
+     * Place SPSC rings on the consumer's node: it polls the slots and the
+     * head index continuously, the producer only writes each slot once.
+     *
+     * Degrades to first-touch placement when `node` is ANY_NUMA_NODE, does
+     * not exist, or the kernel has no NUMA support.
+     *
+     * Example usage:
+     * @code
+     * // Consumer thread, after pinning itself
+     * auto ring = make_on_node<RingBuffer<Order, 4096>>(current_numa_node());
+     * @endcode
+     *
+     * @throws std::bad_alloc if no memory could be mapped
+     */
+    template<typename T, typename... Args>
+    NodeLocalPtr<T> make_on_node(int node, Args&&... args) {
+        static_assert(alignof(T) <= memory::MappedRegion::PAGE_SIZE, "Type alignment exceeds page size");
+        // Bound but not pre-faulted: the constructor's first touch faults the
+        // pages in on `node`. Unmapped by `region` if the constructor throws.
+        memory::MappedRegion region(sizeof(T), { memory::HugePages::NONE, false, false, node });
+        T* object = ::new (region.data()) T(std::forward<Args>(args)...);
+        (void)region.detach();
+        return NodeLocalPtr<T>(object);
+    }
+
+} // namespace hft::core
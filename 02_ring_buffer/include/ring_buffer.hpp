@@ -3,6 +3,8 @@
 #include <atomic>
 #include <array>
 #include <optional>
+#include <span>
+#include <algorithm>
 #include <stdexcept>
 #include <type_traits>
 #include <limits>
@@ -75,7 +77,7 @@ namespace hft::core {
          *
          * Memory ordering strategy:
          * - Relaxed load of head: We own head, no sync needed
-         * - Acquire load of tail: Synchronize with consumer's release store
+         * - Acquire load of tail: Only when the cached tail says "full"
          * - Release store of head: Publish our data write to consumer
          *
          * @param item Element to be pushed (moved into buffer)
@@ -91,11 +93,17 @@ namespace hft::core {
             // But ~20-40x faster (1 cycle vs 20-40 cycles)
             const auto next_head = (current_head + 1) & INDEX_MASK;
 
-            // Check if buffer is full
-            // memory_order_acquire: Synchronize with consumer's tail release
-            // This ensures we see the consumer's latest pop operations
-            if (next_head == tail_.load(std::memory_order_acquire)) {
-                return false;  // Buffer full
+            // Check if buffer is full against our cached copy of tail first.
+            // The cached value can only be behind the real tail (the consumer
+            // only moves it forward), so "not full" here is always correct and
+            // we skip touching the consumer's cache line entirely.
+            if (next_head == cached_tail_) {
+                // Looks full: refresh from the shared tail
+                // memory_order_acquire: Synchronize with consumer's tail release
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (next_head == cached_tail_) {
+                    return false;  // Buffer full
+                }
             }
 
             // Move item into buffer at current head position
@@ -124,7 +132,7 @@ namespace hft::core {
          *
          * Memory ordering strategy:
          * - Relaxed load of tail: We own tail, no sync needed
-         * - Acquire load of head: Synchronize with producer's release store
+         * - Acquire load of head: Only when the cached head says "empty"
          * - Release store of tail: Publish that we've consumed the data
          *
          * @return std::optional<T> Popped element or std::nullopt if buffer is empty
@@ -134,12 +142,16 @@ namespace hft::core {
             // memory_order_relaxed: Safe because only consumer writes tail
             const auto current_tail = tail_.load(std::memory_order_relaxed);
 
-            // Check if buffer is empty
-            // memory_order_acquire: Synchronize with producer's head release
-            // This ensures we see the producer's latest push operations
-            // and the data they wrote to the buffer
-            if (current_tail == head_.load(std::memory_order_acquire)) {
-                return std::nullopt;  // Buffer empty
+            // Check if buffer is empty against our cached copy of head first
+            // (see try_push). Elements below the cached head were already
+            // synchronized by the acquire load that produced it.
+            if (current_tail == cached_head_) {
+                // Looks empty: refresh from the shared head
+                // memory_order_acquire: Synchronize with producer's head release
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (current_tail == cached_head_) {
+                    return std::nullopt;  // Buffer empty
+                }
             }
 
             // Extract item from buffer at current tail position
@@ -154,6 +166,132 @@ namespace hft::core {
             return item;
         }
 
+        // ------------------------------------------------------------------
+        // Batch operations: one acquire load + one release store per batch
+        // ------------------------------------------------------------------
+
+        /**
+         * @brief Push up to `count` elements in one publish (Producer operation)
+         *
+         * Reads the consumer's tail once and publishes all copied elements with
+         * a single release store of head, instead of one acquire/release pair
+         * per element.
+         *
+         * @param items Elements to copy into the buffer
+         * @param count Number of elements available in `items`
+         * @return Number of elements pushed (0 if the buffer is full)
+         */
+        [[nodiscard]] size_t try_push_n(const T* items, size_t count) noexcept {
+            const auto current_head = head_.load(std::memory_order_relaxed);
+            const size_t free_slots = producer_free_slots(current_head, count);
+            const size_t n = std::min(count, free_slots);
+
+            for (size_t i = 0; i < n; ++i) {
+                buffer_[(current_head + i) & INDEX_MASK] = items[i];
+            }
+
+            head_.store((current_head + n) & INDEX_MASK, std::memory_order_release);
+            return n;
+        }
+
+        /**
+         * @brief Pop up to `max_count` elements in one release (Consumer operation)
+         *
+         * @param out Destination for popped elements (moved out of the buffer)
+         * @param max_count Capacity of `out`
+         * @return Number of elements popped (0 if the buffer is empty)
+         */
+        [[nodiscard]] size_t try_pop_n(T* out, size_t max_count) noexcept {
+            const auto current_tail = tail_.load(std::memory_order_relaxed);
+            const size_t available = consumer_available(current_tail, max_count);
+            const size_t n = std::min(max_count, available);
+
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = std::move(buffer_[(current_tail + i) & INDEX_MASK]);
+            }
+
+            tail_.store((current_tail + n) & INDEX_MASK, std::memory_order_release);
+            return n;
+        }
+
+        /**
+         * @brief Claim contiguous free slots to construct elements in place (Producer operation)
+         *
+         * Zero-copy alternative to try_push: write directly into the returned
+         * slots, then publish them with commit(). The span stops at the end of
+         * the underlying array, so it may be shorter than `max_count` even when
+         * more slots are free; claim again after committing to get the rest.
+         *
+         * Nothing is visible to the consumer until commit().
+         *
+         * @param max_count Maximum number of slots wanted
+         * @return Writable slots starting at the current head (empty if full)
+         */
+        [[nodiscard]] std::span<T> claim(size_t max_count) noexcept {
+            const auto current_head = head_.load(std::memory_order_relaxed);
+            const size_t until_wrap = BufferSize - current_head;
+            const size_t free_slots = producer_free_slots(current_head, std::min(max_count, until_wrap));
+            return std::span<T>(&buffer_[current_head], std::min({ max_count, free_slots, until_wrap }));
+        }
+
+        /**
+         * @brief Publish the first `count` slots returned by the last claim()
+         *
+         * A single release store makes all `count` elements visible at once.
+         *
+         * @param count Number of slots written (must not exceed the claimed span size)
+         */
+        void commit(size_t count) noexcept {
+            const auto current_head = head_.load(std::memory_order_relaxed);
+            head_.store((current_head + count) & INDEX_MASK, std::memory_order_release);
+        }
+
+        /**
+         * @brief View contiguous readable elements in place (Consumer operation)
+         *
+         * Elements stay owned by the buffer until consume(); the producer cannot
+         * overwrite them before then. Like claim(), the span stops at the end of
+         * the underlying array.
+         *
+         * @param max_count Maximum number of elements wanted
+         * @return Readable elements starting at the current tail (empty if empty)
+         */
+        [[nodiscard]] std::span<const T> read_span(size_t max_count) noexcept {
+            const auto current_tail = tail_.load(std::memory_order_relaxed);
+            const size_t until_wrap = BufferSize - current_tail;
+            const size_t available = consumer_available(current_tail, std::min(max_count, until_wrap));
+            return std::span<const T>(&buffer_[current_tail], std::min({ max_count, available, until_wrap }));
+        }
+
+        /**
+         * @brief Release the first `count` elements returned by the last read_span()
+         *
+         * @param count Number of elements processed (must not exceed the span size)
+         */
+        void consume(size_t count) noexcept {
+            const auto current_tail = tail_.load(std::memory_order_relaxed);
+            tail_.store((current_tail + count) & INDEX_MASK, std::memory_order_release);
+        }
+
+        /**
+         * @brief Pop an element, waiting until one is available (Consumer operation)
+         *
+         * How the consumer waits is chosen per consumer by `strategy` (see
+         * wait_strategy.hpp): busy-spin, spin with PAUSE, spin-then-yield or
+         * futex sleep. The producer must call strategy.notify() after each
+         * successful push for the sleeping strategies to wake up.
+         *
+         * Blocks until an element arrives; to shut a consumer down, push a
+         * sentinel element.
+         *
+         * @param strategy Wait strategy shared with the producer
+         * @return The popped element
+         */
+        template<typename WaitStrategy>
+        [[nodiscard]] T pop_wait(WaitStrategy& strategy) noexcept {
+            return strategy.wait_until([this] { return try_pop(); });
+        }
+
         /**
          * @brief Check if the buffer is empty
          *
@@ -202,6 +340,32 @@ namespace hft::core {
         }
 
     private:
+        /**
+         * Free slots as seen by the producer, refreshing the cached tail only
+         * if the cached view cannot satisfy `wanted`.
+         */
+        size_t producer_free_slots(size_t current_head, size_t wanted) noexcept {
+            size_t free_slots = (cached_tail_ - current_head - 1) & INDEX_MASK;
+            if (free_slots < wanted) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                free_slots = (cached_tail_ - current_head - 1) & INDEX_MASK;
+            }
+            return free_slots;
+        }
+
+        /**
+         * Readable elements as seen by the consumer, refreshing the cached head
+         * only if the cached view cannot satisfy `wanted`.
+         */
+        size_t consumer_available(size_t current_tail, size_t wanted) noexcept {
+            size_t available = (cached_head_ - current_tail) & INDEX_MASK;
+            if (available < wanted) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                available = (cached_head_ - current_tail) & INDEX_MASK;
+            }
+            return available;
+        }
+
         /**
          * Data buffer storing elements
          *
@@ -240,6 +404,20 @@ namespace hft::core {
          * Only consumer thread modifies this (producer only reads).
          */
         alignas(64) std::atomic<size_t> tail_{ 0 };
+
+        /**
+         * Producer-local copy of tail_ (producer reads and writes, consumer never touches)
+         *
+         * Refreshed only when the ring looks full, so while there is room the
+         * producer never reads the consumer's tail_ line. On its own cache line
+         * so the consumer's tail_ stores do not invalidate it.
+         */
+        alignas(64) size_t cached_tail_{ 0 };
+
+        /**
+         * Consumer-local copy of head_ (consumer only, refreshed when the ring looks empty)
+         */
+        alignas(64) size_t cached_head_{ 0 };
     };
 
     /**
@@ -272,8 +450,24 @@ namespace hft::core {
      *    - Needed to distinguish empty (head==tail) from full
      *    - Alternative: Add a counter, but that's another atomic!
      *
-     * 6. Potential Optimizations to Explore:
-     *    - Batch operations (push/pop multiple at once)
+     * 6. Batch Operations (try_push_n / try_pop_n / claim+commit / read_span+consume):
+     *    - One acquire load of the remote index and one release store per batch
+     *    - claim/read_span expose slots in place: no intermediate copy
+     *    - Spans never wrap; callers loop to cover the wrap point
+     *
+     * 7. Cached Remote Index:
+     *    - Each side keeps a private copy of the other side's index and only
+     *      re-reads the shared atomic when the copy says full/empty
+     *    - Steady-state push/pop touches only the caller's own cache lines
+     *      plus the slot itself; the remote line moves once per refresh
+     *      instead of once per operation
+     *
+     * 8. Waiting (pop_wait + wait_strategy.hpp):
+     *    - The ring itself stays wait-free; waiting is a consumer policy
+     *    - Spinning strategies cost the producer nothing; FutexWait costs
+     *      one fence per notify() and a syscall only when the consumer sleeps
+     *
+     * 9. Potential Optimizations to Explore:
      *    - Prefetching hints for buffer access
      *    - Different memory ordering strategies per operation
      *    - Template specialization for trivial types
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "process_liveness.hpp"
+
+namespace hft::core {
+
+    /**
+     * @brief Header at the start of every shared-memory ring
+     *
+     * Lets a process that attaches by name verify it is looking at the ring
+     * it expects (same element size/alignment/capacity, same layout version)
+     * and detect a peer that crashed or shut down. The pids also tell
+     * SharedMemoryRegion::create() whether a segment by that name is still in use.
+     */
+    struct ShmRingHeader {
+        static constexpr uint64_t MAGIC = 0x474E495231564D53ULL;  // "SMV1RING" (little-endian)
+        static constexpr uint32_t VERSION = 2;
+
+        enum State : uint32_t {
+            UNINITIALIZED = 0,
+            READY = 1,
+            PRODUCER_CLOSED = 2,  // Producer finished cleanly; drain then detach
+        };
+
+        uint64_t magic{0};
+        uint32_t version{0};
+        uint32_t element_size{0};
+        uint32_t element_align{0};
+        std::atomic<int32_t> creator_pid{0};   // Process that ran ShmRingBuffer::create()
+        uint64_t capacity{0};
+        uint64_t total_size{0};
+
+        std::atomic<uint32_t> state{UNINITIALIZED};
+        std::atomic<int32_t> producer_pid{0};  // 0 = no producer attached
+        std::atomic<int32_t> consumer_pid{0};  // 0 = no consumer attached
+    };
+
+    /**
+     * @brief Lock-free SPSC Ring Buffer that lives in shared memory
+     *
+     * Same algorithm as RingBuffer, laid out so it can be placed at the start
+     * of a MAP_SHARED mapping and used from two processes:
+     * - Position-independent: the object holds only indices and inline
+     *   elements, never pointers, so each process may map it at a different
+     *   address.
+     * - Header with magic/version/element size/capacity, validated on attach.
+     * - Crash detection: each side registers its pid; when the ring stays
+     *   empty (or full), the other side can ask whether its peer is still
+     *   alive (a kill(pid, 0) syscall - only on the slow path).
+     *
+     * Elements are copied bytewise between address spaces, so T must be
+     * trivially copyable and must not contain pointers into either process.
+     *
+     * Thread Safety: exactly one producer and one consumer, in the same or
+     * different processes.
+     *
+     * @tparam T Element type (trivially copyable)
+     * @tparam BufferSize Compile-time fixed size (must be power of 2)
+     *
+     * Example usage:
+     * @code
+     * using Ring = ShmRingBuffer<Event, 4096>;
+     *
+     * // Feed-handler process
+     * auto region = SharedMemoryRegion::create("/itch_events", sizeof(Ring));
+     * Ring* ring = Ring::create(region->data());
+     * ring->register_producer();
+     * (void)ring->try_push(event);
+     *
+     * // Strategy process
+     * auto region = SharedMemoryRegion::open("/itch_events");
+     * Ring* ring = Ring::attach(region->data(), region->size());
+     * ring->register_consumer();
+     * if (auto e = ring->try_pop()) { ... }
+     * @endcode
+     */
+    template<typename T, size_t BufferSize>
+    class ShmRingBuffer {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>,
+            "ShmRingBuffer elements cross address spaces and must be trivially copyable");
+        static_assert(BufferSize > 0 && (BufferSize & (BufferSize - 1)) == 0,
+            "BufferSize must be power of 2 for optimal performance (enables bit masking)");
+        static_assert(std::atomic<size_t>::is_always_lock_free,
+            "Shared-memory atomics must be lock-free (address-free)");
+
+        static constexpr size_t INDEX_MASK = BufferSize - 1;
+
+        ShmRingBuffer(const ShmRingBuffer&) = delete;
+        ShmRingBuffer& operator=(const ShmRingBuffer&) = delete;
+
+        /**
+         * @brief Construct a fresh ring at `memory` (creator process only)
+         *
+         * @param memory Start of a mapping of at least sizeof(ShmRingBuffer) bytes,
+         *               aligned to 64 bytes (mmap returns page-aligned memory)
+         */
+        static ShmRingBuffer* create(void* memory) noexcept {
+            auto* ring = new (memory) ShmRingBuffer();
+            ring->header_.magic = ShmRingHeader::MAGIC;
+            ring->header_.version = ShmRingHeader::VERSION;
+            ring->header_.element_size = sizeof(T);
+            ring->header_.element_align = alignof(T);
+            ring->header_.capacity = BufferSize;
+            ring->header_.total_size = sizeof(ShmRingBuffer);
+            ring->header_.creator_pid.store(getpid(), std::memory_order_relaxed);
+            // Release: a process that sees READY also sees the fields above
+            ring->header_.state.store(ShmRingHeader::READY, std::memory_order_release);
+            return ring;
+        }
+
+        /**
+         * @brief Validate and use a ring created by another process
+         *
+         * @return nullptr if the mapping is too small, not initialized yet, or was
+         *         created for a different element type/capacity/layout version
+         */
+        static ShmRingBuffer* attach(void* memory, size_t mapping_size) noexcept {
+            if (memory == nullptr || mapping_size < sizeof(ShmRingBuffer)) {
+                return nullptr;
+            }
+            auto* ring = static_cast<ShmRingBuffer*>(memory);
+            const ShmRingHeader& h = ring->header_;
+            if (h.state.load(std::memory_order_acquire) == ShmRingHeader::UNINITIALIZED ||
+                h.magic != ShmRingHeader::MAGIC ||
+                h.version != ShmRingHeader::VERSION ||
+                h.element_size != sizeof(T) ||
+                h.element_align != alignof(T) ||
+                h.capacity != BufferSize ||
+                h.total_size != sizeof(ShmRingBuffer)) {
+                return nullptr;
+            }
+            return ring;
+        }
+
+        // ------------------------------------------------------------------
+        // Data path (identical ordering to RingBuffer)
+        // ------------------------------------------------------------------
+
+        /**
+         * @brief Attempt to push an element (producer process only)
+         * @return true if push was successful, false if buffer is full
+         */
+        [[nodiscard]] bool try_push(const T& item) noexcept {
+            const auto current_head = head_.load(std::memory_order_relaxed);
+            const auto next_head = (current_head + 1) & INDEX_MASK;
+
+            if (next_head == tail_.load(std::memory_order_acquire)) {
+                return false;  // Buffer full
+            }
+
+            buffer_[current_head] = item;
+            head_.store(next_head, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Attempt to pop an element (consumer process only)
+         * @return std::optional<T> Popped element or std::nullopt if buffer is empty
+         */
+        [[nodiscard]] std::optional<T> try_pop() noexcept {
+            const auto current_tail = tail_.load(std::memory_order_relaxed);
+
+            if (current_tail == head_.load(std::memory_order_acquire)) {
+                return std::nullopt;  // Buffer empty
+            }
+
+            T item = buffer_[current_tail];
+            tail_.store((current_tail + 1) & INDEX_MASK, std::memory_order_release);
+            return item;
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return head_.load(std::memory_order_relaxed) ==
+                tail_.load(std::memory_order_relaxed);
+        }
+
+        // ------------------------------------------------------------------
+        // Peer tracking / crash detection (slow path)
+        // ------------------------------------------------------------------
+
+        void register_producer() noexcept { header_.producer_pid.store(getpid(), std::memory_order_release); }
+        void register_consumer() noexcept { header_.consumer_pid.store(getpid(), std::memory_order_release); }
+
+        /// Producer is done; a consumer that finds the ring empty can stop
+        void close_producer() noexcept {
+            header_.state.store(ShmRingHeader::PRODUCER_CLOSED, std::memory_order_release);
+            header_.producer_pid.store(0, std::memory_order_release);
+        }
+
+        void unregister_consumer() noexcept { header_.consumer_pid.store(0, std::memory_order_release); }
+
+        [[nodiscard]] bool producer_closed() const noexcept {
+            return header_.state.load(std::memory_order_acquire) == ShmRingHeader::PRODUCER_CLOSED;
+        }
+
+        /// False if a producer registered and its process no longer exists
+        [[nodiscard]] bool producer_alive() const noexcept {
+            return peer_alive(header_.producer_pid.load(std::memory_order_acquire));
+        }
+
+        /// False if a consumer registered and its process no longer exists
+        [[nodiscard]] bool consumer_alive() const noexcept {
+            return peer_alive(header_.consumer_pid.load(std::memory_order_acquire));
+        }
+
+        [[nodiscard]] const ShmRingHeader& header() const noexcept { return header_; }
+
+    private:
+        ShmRingBuffer() noexcept = default;
+
+        static bool peer_alive(int32_t pid) noexcept {
+            // Nobody registered yet: nothing to declare dead
+            return pid <= 0 || memory::process_alive(pid);
+        }
+
+        // Header first so attach() can validate before touching anything else
+        alignas(64) ShmRingHeader header_;
+
+        // Producer-owned and consumer-owned indices on separate cache lines
+        alignas(64) std::atomic<size_t> head_{ 0 };
+        alignas(64) std::atomic<size_t> tail_{ 0 };
+
+        alignas(64) std::array<T, BufferSize> buffer_{};
+    };
+
+    /**
+     * @brief RAII POSIX shared-memory mapping (shm_open + mmap)
+     *
+     * The creator owns the name and unlinks it on destruction; processes that
+     * open() an existing region only unmap.
+     */
+    class SharedMemoryRegion {
+    public:
+        /**
+         * @brief Create a new region, unless a live ring already holds the name
+         *
+         * Returns nullopt if `name` holds a ring that is not PRODUCER_CLOSED
+         * and whose creator or producer process still exists: replacing it
+         * would strand that producer on an orphaned segment while new
+         * consumers attach to an empty one. Empty, truncated, closed or
+         * dead-owner segments are unlinked and recreated (processes still
+         * mapping them keep the old object). Not a lock - two creators
+         * starting at the same instant are still arbitrated only by O_EXCL.
+         */
+        static std::optional<SharedMemoryRegion> create(const std::string& name, size_t size) {
+            if (owned_by_live_ring(name)) {
+                return std::nullopt;
+            }
+            shm_unlink(name.c_str());
+            int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) {
+                return std::nullopt;
+            }
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                close(fd);
+                shm_unlink(name.c_str());
+                return std::nullopt;
+            }
+            void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (data == MAP_FAILED) {
+                shm_unlink(name.c_str());
+                return std::nullopt;
+            }
+            return SharedMemoryRegion(name, data, size, true);
+        }
+
+        /// Map an existing region read-write (both ring sides write an index)
+        static std::optional<SharedMemoryRegion> open(const std::string& name) {
+            int fd = shm_open(name.c_str(), O_RDWR, 0);
+            if (fd < 0) {
+                return std::nullopt;
+            }
+            struct stat st {};
+            if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+                close(fd);
+                return std::nullopt;
+            }
+            const auto size = static_cast<size_t>(st.st_size);
+            void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (data == MAP_FAILED) {
+                return std::nullopt;
+            }
+            return SharedMemoryRegion(name, data, size, false);
+        }
+
+        SharedMemoryRegion(SharedMemoryRegion&& other) noexcept
+            : name_(std::move(other.name_)),
+              data_(std::exchange(other.data_, nullptr)),
+              size_(std::exchange(other.size_, 0)),
+              owner_(std::exchange(other.owner_, false)) {}
+
+        SharedMemoryRegion& operator=(SharedMemoryRegion&&) = delete;
+        SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+        ~SharedMemoryRegion() {
+            if (data_) {
+                munmap(data_, size_);
+            }
+            if (owner_) {
+                shm_unlink(name_.c_str());
+            }
+        }
+
+        [[nodiscard]] void* data() const noexcept { return data_; }
+        [[nodiscard]] size_t size() const noexcept { return size_; }
+
+    private:
+        /// True if `name` holds a ring header whose owner process still exists
+        static bool owned_by_live_ring(const std::string& name) noexcept {
+            int fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) {
+                return false;
+            }
+            struct stat st {};
+            void* data = MAP_FAILED;
+            if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(ShmRingHeader)) {
+                data = mmap(nullptr, sizeof(ShmRingHeader), PROT_READ, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+            if (data == MAP_FAILED) {
+                return false;  // Empty or truncated: a creator died before sizing it
+            }
+
+            const auto* header = static_cast<const ShmRingHeader*>(data);
+            const bool live = header->magic == ShmRingHeader::MAGIC &&
+                              header->state.load(std::memory_order_acquire) != ShmRingHeader::PRODUCER_CLOSED &&
+                              (memory::process_alive(header->creator_pid.load(std::memory_order_acquire)) ||
+                               memory::process_alive(header->producer_pid.load(std::memory_order_acquire)));
+            munmap(data, sizeof(ShmRingHeader));
+            return live;
+        }
+
+        SharedMemoryRegion(std::string name, void* data, size_t size, bool owner)
+            : name_(std::move(name)), data_(data), size_(size), owner_(owner) {}
+
+        std::string name_;
+        void* data_{nullptr};
+        size_t size_{0};
+        bool owner_{false};
+    };
+
+} // namespace hft::core
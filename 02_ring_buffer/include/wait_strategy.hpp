@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hft::core {
+
+    /**
+     * @brief CPU hint for spin loops
+     *
+     * On x86 PAUSE (~40-140 cycles on recent cores) stops the spinning core
+     * from flooding the pipeline with speculative loads, frees resources for
+     * a hyperthread sibling and avoids the memory-order machine clear when
+     * the awaited line finally changes.
+     */
+    inline void cpu_relax() noexcept {
+#if defined(_MSC_VER)
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    /**
+     * @brief Consumer wait strategies for RingBuffer::pop_wait()
+     *
+     * Each strategy trades wake-up latency against CPU burned while idle:
+     *
+     * | Strategy       | Idle CPU       | Wake-up latency            |
+     * |----------------|----------------|----------------------------|
+     * | BusySpinWait   | 100% (hot)     | Cache-line transfer only   |
+     * | PauseSpinWait  | 100% (cooler)  | + up to one PAUSE          |
+     * | YieldWait      | ~100% if alone | + a scheduler pass         |
+     * | FutexWait      | ~0% asleep     | + futex wake (~2-10 us)    |
+     *
+     * Interface (duck-typed, no virtual calls on the hot path):
+     * - wait_until(poll): call `poll()` until it returns an engaged
+     *   std::optional and return its value (consumer side)
+     * - notify(): called by the producer after each publish; free for the
+     *   spinning strategies
+     *
+     * A strategy object is shared by one producer and one consumer, so each
+     * consumer can pick its own.
+     *
+     * Example usage:
+     * @code
+     * RingBuffer<Event, 1024> ring;
+     * FutexWait wait;
+     *
+     * // Producer thread
+     * if (ring.try_push(event)) {
+     *     wait.notify();
+     * }
+     *
+     * // Consumer thread
+     * Event e = ring.pop_wait(wait);
+     * @endcode
+     */
+
+    /// Re-poll as fast as possible: lowest latency, burns a full core
+    class BusySpinWait {
+    public:
+        template<typename Poll>
+        auto wait_until(Poll&& poll) noexcept {
+            while (true) {
+                if (auto item = poll()) {
+                    return std::move(*item);
+                }
+            }
+        }
+
+        void notify() noexcept {}
+    };
+
+    /// Re-poll with a PAUSE between attempts: same latency class, kinder to the core
+    class PauseSpinWait {
+    public:
+        template<typename Poll>
+        auto wait_until(Poll&& poll) noexcept {
+            while (true) {
+                if (auto item = poll()) {
+                    return std::move(*item);
+                }
+                cpu_relax();
+            }
+        }
+
+        void notify() noexcept {}
+    };
+
+    /// Spin briefly, then yield the core between polls
+    class YieldWait {
+    public:
+        static constexpr uint32_t SPIN_LIMIT = 100;
+
+        template<typename Poll>
+        auto wait_until(Poll&& poll) noexcept {
+            uint32_t spins = 0;
+            while (true) {
+                if (auto item = poll()) {
+                    return std::move(*item);
+                }
+                if (spins < SPIN_LIMIT) {
+                    ++spins;
+                    cpu_relax();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void notify() noexcept {}
+    };
+
+    /**
+     * @brief Spin briefly, then sleep in the kernel until the producer wakes us
+     *
+     * Lost-wakeup protocol (Dekker-style, one full fence per side):
+     * - Consumer: sleepers_++, read epoch_, poll once more, futex-wait on
+     *   epoch_ (the kernel re-checks epoch_ before sleeping)
+     * - Producer: publish, full fence, read sleepers_; only if non-zero bump
+     *   epoch_ and futex-wake
+     * Either the producer sees the sleeper, or the consumer's final poll sees
+     * the data. With nobody asleep notify() is a fence plus a load of a line
+     * the consumer only writes when it goes to sleep: no syscall, no shared
+     * write.
+     */
+    class FutexWait {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+            "futex operates on the raw 32-bit word");
+
+    public:
+        static constexpr uint32_t SPIN_LIMIT = 1000;
+
+        template<typename Poll>
+        auto wait_until(Poll&& poll) noexcept {
+            for (uint32_t spins = 0; spins < SPIN_LIMIT; ++spins) {
+                if (auto item = poll()) {
+                    return std::move(*item);
+                }
+                cpu_relax();
+            }
+
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            while (true) {
+                const uint32_t epoch = epoch_.load(std::memory_order_seq_cst);
+                // Order sleepers_++ before the re-poll (pairs with notify())
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (auto item = poll()) {
+                    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+                    return std::move(*item);
+                }
+                sleep_while(epoch);
+            }
+        }
+
+        void notify() noexcept {
+            // Order the producer's publish before reading sleepers_
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_relaxed) != 0) {
+                epoch_.fetch_add(1, std::memory_order_seq_cst);
+                wake();
+            }
+        }
+
+        /// Times the consumer actually went to sleep (diagnostics)
+        [[nodiscard]] uint64_t sleeps() const noexcept {
+            return sleeps_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void sleep_while(uint32_t epoch) noexcept {
+            sleeps_.fetch_add(1, std::memory_order_relaxed);
+#if defined(__linux__)
+            // Returns immediately (EAGAIN) if epoch_ already moved on
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_), FUTEX_WAIT_PRIVATE,
+                    epoch, nullptr, nullptr, 0);
+#else
+            epoch_.wait(epoch, std::memory_order_seq_cst);
+#endif
+        }
+
+        void wake() noexcept {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_), FUTEX_WAKE_PRIVATE,
+                    INT_MAX, nullptr, nullptr, 0);
+#else
+            epoch_.notify_all();
+#endif
+        }
+
+        // Written by the producer only when someone sleeps
+        alignas(64) std::atomic<uint32_t> epoch_{ 0 };
+        // Written by the consumer only on the way to/from sleep
+        alignas(64) std::atomic<uint32_t> sleepers_{ 0 };
+        std::atomic<uint64_t> sleeps_{ 0 };
+    };
+
+} // namespace hft::core
@@ -0,0 +1,196 @@
+#include "broadcast_ring.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// Broadcast ring benchmark: one writer, 1-8 readers each seeing every event
+//
+// BACKPRESSURE: every reader must receive every event in order; throughput
+// is set by the slowest reader.
+// OVERWRITE: the writer never waits; we report how many events readers lost
+// to lapping instead.
+//
+// The writer yields every BURST events, as a feed handler would between
+// packets, so readers sharing its core still get to run.
+namespace hft::benchmark {
+
+    struct BookEvent {
+        uint64_t sequence;
+        uint64_t price;
+        uint64_t quantity;
+        uint64_t flags;
+    };
+
+    constexpr size_t RING_SIZE = 4096;  // Power of 2
+    constexpr size_t MAX_READERS = 8;
+    constexpr uint64_t NUM_EVENTS = 1'000'000;
+    constexpr uint64_t BURST = 256;     // Events per simulated packet (power of 2)
+
+    struct BroadcastResult {
+        std::string mode;
+        size_t readers;
+        double writer_mops;
+        double delivered_mops;  // Events received summed over all readers
+        uint64_t lapped;
+        bool in_order;
+    };
+
+    inline void backoff(uint32_t& spins) {
+        if (++spins > 64) {
+            std::this_thread::yield();
+            spins = 0;
+        }
+    }
+
+    template<hft::core::OverflowPolicy Policy>
+    BroadcastResult benchmark_readers(const char* mode, size_t num_readers) {
+        using Ring = hft::core::BroadcastRing<BookEvent, RING_SIZE, MAX_READERS, Policy>;
+        auto ring = std::make_unique<Ring>();
+
+        std::vector<size_t> ids;
+        for (size_t r = 0; r < num_readers; ++r) {
+            ids.push_back(*ring->add_reader());
+        }
+
+        std::atomic<bool> writer_done{ false };
+        std::vector<uint64_t> received(num_readers, 0);
+        std::vector<char> in_order(num_readers, 1);
+        std::vector<uint64_t> checksums(num_readers, 0);
+        std::vector<std::thread> readers;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < num_readers; ++r) {
+            readers.emplace_back([&, r]() {
+                const size_t id = ids[r];
+                uint64_t count = 0;
+                uint64_t checksum = 0;
+                uint32_t spins = 0;
+                while (true) {
+                    uint64_t batch = 0;
+                    uint64_t batch_sum = 0;
+                    bool batch_ordered = true;
+                    auto status = ring->read(id, [&](const BookEvent& e, uint64_t seq) {
+                        batch_sum += e.price;  // Touch the event in place
+                        batch_ordered &= (e.sequence == seq);
+                        ++batch;
+                    });
+                    if (status == hft::core::ReadStatus::OK) {
+                        // Only a validated batch counts (LAPPED batches may be torn)
+                        count += batch;
+                        checksum += batch_sum;
+                        in_order[r] &= batch_ordered;
+                        spins = 0;
+                    } else if (status == hft::core::ReadStatus::EMPTY) {
+                        if (writer_done.load(std::memory_order_acquire) && ring->lag(id) == 0) {
+                            break;
+                        }
+                        backoff(spins);
+                    }
+                }
+                received[r] = count;
+                checksums[r] = checksum;
+            });
+        }
+
+        uint32_t spins = 0;
+        for (uint64_t i = 0; i < NUM_EVENTS; ++i) {
+            BookEvent* slot;
+            while ((slot = ring->try_claim()) == nullptr) {
+                backoff(spins);
+            }
+            *slot = BookEvent{ i, 1'500'000 + (i & 0xFF), 100, 0 };
+            ring->publish();
+            if ((i & (BURST - 1)) == BURST - 1) {
+                std::this_thread::yield();  // Packet boundary: give readers a chance
+            }
+        }
+        auto writer_end = std::chrono::steady_clock::now();
+        writer_done.store(true, std::memory_order_release);
+
+        for (auto& th : readers) {
+            th.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        volatile uint64_t sink = 0;  // Keep the in-place reads observable
+        for (uint64_t c : checksums) {
+            sink = sink + c;
+        }
+
+        uint64_t delivered = 0;
+        uint64_t lapped = 0;
+        bool ordered = true;
+        for (size_t r = 0; r < num_readers; ++r) {
+            delivered += received[r];
+            lapped += ring->lapped_events(ids[r]);
+            ordered &= in_order[r] != 0;
+            if (Policy == hft::core::OverflowPolicy::BACKPRESSURE && received[r] != NUM_EVENTS) {
+                ordered = false;  // Backpressure must never drop an event
+            }
+        }
+
+        double writer_s = std::chrono::duration<double>(writer_end - start).count();
+        double total_s = std::chrono::duration<double>(end - start).count();
+        return { mode, num_readers, NUM_EVENTS / writer_s / 1e6, delivered / total_s / 1e6, lapped, ordered };
+    }
+
+    void run_benchmark() {
+        std::cout << "=== HFT Broadcast Ring Benchmark ===" << std::endl;
+        std::cout << "Ring Size: " << RING_SIZE << " x " << sizeof(BookEvent) << " bytes" << std::endl;
+        std::cout << "Events: " << NUM_EVENTS << std::endl;
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+        if (std::thread::hardware_concurrency() < 2) {
+            std::cout << "WARNING: single hardware thread - writer and readers time-slice one core." << std::endl;
+        }
+
+        std::vector<BroadcastResult> results;
+        for (size_t readers : { 1, 2, 4, 8 }) {
+            results.push_back(benchmark_readers<hft::core::OverflowPolicy::BACKPRESSURE>("backpressure", readers));
+        }
+        for (size_t readers : { 1, 2, 4, 8 }) {
+            results.push_back(benchmark_readers<hft::core::OverflowPolicy::OVERWRITE>("overwrite", readers));
+        }
+
+        std::cout << "\n" << std::string(82, '=') << std::endl;
+        std::cout << std::left << std::setw(14) << "Mode"
+                  << std::right << std::setw(9) << "Readers"
+                  << std::setw(16) << "Writer M/s"
+                  << std::setw(18) << "Delivered M/s"
+                  << std::setw(16) << "Lapped events"
+                  << std::setw(9) << "Order" << std::endl;
+        std::cout << std::string(82, '-') << std::endl;
+        for (const auto& r : results) {
+            std::cout << std::left << std::setw(14) << r.mode
+                      << std::right << std::setw(9) << r.readers
+                      << std::setw(16) << std::fixed << std::setprecision(2) << r.writer_mops
+                      << std::setw(18) << r.delivered_mops
+                      << std::setw(16) << r.lapped
+                      << std::setw(9) << (r.in_order ? "ok" : "FAIL") << std::endl;
+        }
+        std::cout << std::string(82, '=') << std::endl;
+
+        for (const auto& r : results) {
+            if (!r.in_order) {
+                throw std::runtime_error("broadcast ring delivered events out of order");
+            }
+        }
+    }
+}
+
+int main() {
+    try {
+        hft::benchmark::run_benchmark();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -5,30 +5,32 @@
 #include <array>
 #include <atomic>
 #include <optional>
-
-// Optimized Ring Buffer with power-of-2 masking
-namespace hft::core {
+#include <algorithm>
+#include <thread>
+#include <iomanip>
+#include "ring_buffer.hpp"
+#include "numa_placement.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Reference copy of RingBuffer before the cached-index change: every
+// try_push/try_pop loads the other side's atomic index. Kept here so the
+// benchmark can report before/after on the same machine.
+namespace hft::benchmark::baseline {
     template<typename T, size_t BufferSize>
-    class RingBuffer {
+    class UncachedRingBuffer {
     public:
-        static_assert((BufferSize& (BufferSize - 1)) == 0,
-            "BufferSize must be power of 2 for optimal performance");
-        static_assert(std::is_move_constructible_v<T>);
-
         static constexpr size_t INDEX_MASK = BufferSize - 1;
 
-        RingBuffer() noexcept = default;
-        RingBuffer(const RingBuffer&) = delete;
-        RingBuffer& operator=(const RingBuffer&) = delete;
-
         [[nodiscard]] bool try_push(T item) noexcept {
             const auto current_head = head_.load(std::memory_order_relaxed);
             const auto next_head = (current_head + 1) & INDEX_MASK;
-
             if (next_head == tail_.load(std::memory_order_acquire)) {
                 return false;
             }
-
             buffer_[current_head] = std::move(item);
             head_.store(next_head, std::memory_order_release);
             return true;
@@ -36,21 +38,14 @@ namespace hft::core {
 
         [[nodiscard]] std::optional<T> try_pop() noexcept {
             const auto current_tail = tail_.load(std::memory_order_relaxed);
-
             if (current_tail == head_.load(std::memory_order_acquire)) {
                 return std::nullopt;
             }
-
             T item = std::move(buffer_[current_tail]);
             tail_.store((current_tail + 1) & INDEX_MASK, std::memory_order_release);
             return item;
         }
 
-        [[nodiscard]] bool empty() const noexcept {
-            return head_.load(std::memory_order_relaxed) ==
-                tail_.load(std::memory_order_relaxed);
-        }
-
     private:
         alignas(64) std::array<T, BufferSize> buffer_{};
         alignas(64) std::atomic<size_t> head_{ 0 };
@@ -109,6 +104,276 @@ namespace hft::benchmark {
         return std::chrono::duration<double>(end - start).count();
     }
 
+    // Benchmark: producer thread -> consumer thread, moving `batch` messages per operation
+    // using try_push_n/try_pop_n. batch == 1 uses the per-element try_push/try_pop.
+    constexpr size_t BATCH_MESSAGES = 10'000'000;
+
+    double benchmark_batch_copy(size_t batch) {
+        static hft::core::RingBuffer<int, BUFFER_SIZE> ring_buffer;
+
+        std::thread consumer([batch] {
+            std::vector<int> out(batch);
+            size_t received = 0;
+            long long checksum = 0;
+            while (received < BATCH_MESSAGES) {
+                size_t n = 0;
+                if (batch == 1) {
+                    if (auto item = ring_buffer.try_pop()) {
+                        out[0] = *item;
+                        n = 1;
+                    }
+                } else {
+                    n = ring_buffer.try_pop_n(out.data(), batch);
+                }
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    checksum += out[i];
+                }
+                received += n;
+            }
+            if (checksum < 0) {
+                std::cout << checksum;  // Keep the reads observable
+            }
+        });
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::vector<int> in(batch);
+        size_t sent = 0;
+        while (sent < BATCH_MESSAGES) {
+            const size_t want = std::min(batch, BATCH_MESSAGES - sent);
+            for (size_t i = 0; i < want; ++i) {
+                in[i] = static_cast<int>(sent + i);
+            }
+            size_t n = 0;
+            if (batch == 1) {
+                n = ring_buffer.try_push(in[0]) ? 1 : 0;
+            } else {
+                n = ring_buffer.try_push_n(in.data(), want);
+            }
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+            sent += n;
+        }
+        consumer.join();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    // Benchmark: same pipeline, zero-copy - producer writes into claim()ed slots,
+    // consumer reads from read_span() in place.
+    double benchmark_batch_zero_copy(size_t batch) {
+        static hft::core::RingBuffer<int, BUFFER_SIZE> ring_buffer;
+
+        std::thread consumer([batch] {
+            size_t received = 0;
+            long long checksum = 0;
+            while (received < BATCH_MESSAGES) {
+                auto span = ring_buffer.read_span(batch);
+                if (span.empty()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (int value : span) {
+                    checksum += value;
+                }
+                ring_buffer.consume(span.size());
+                received += span.size();
+            }
+            if (checksum < 0) {
+                std::cout << checksum;
+            }
+        });
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        size_t sent = 0;
+        while (sent < BATCH_MESSAGES) {
+            auto slots = ring_buffer.claim(std::min(batch, BATCH_MESSAGES - sent));
+            if (slots.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < slots.size(); ++i) {
+                slots[i] = static_cast<int>(sent + i);
+            }
+            ring_buffer.commit(slots.size());
+            sent += slots.size();
+        }
+        consumer.join();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    void run_batch_benchmark() {
+        constexpr std::array<size_t, 6> BATCH_SIZES = { 1, 4, 16, 64, 256, 512 };
+
+        std::cout << "\n=== Batch Throughput (producer thread -> consumer thread) ===" << std::endl;
+        std::cout << "Messages per run: " << BATCH_MESSAGES << std::endl;
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl << std::endl;
+        std::cout << std::setw(8) << "Batch"
+                  << std::setw(22) << "push_n/pop_n (M/s)"
+                  << std::setw(24) << "claim/read_span (M/s)" << std::endl;
+
+        for (size_t batch : BATCH_SIZES) {
+            double best_copy = 1e9;
+            double best_zero_copy = 1e9;
+            for (size_t run = 0; run < 3; ++run) {
+                best_copy = std::min(best_copy, benchmark_batch_copy(batch));
+                best_zero_copy = std::min(best_zero_copy, benchmark_batch_zero_copy(batch));
+            }
+            std::cout << std::setw(8) << batch
+                      << std::setw(22) << std::fixed << std::setprecision(1) << (BATCH_MESSAGES / best_copy / 1e6)
+                      << std::setw(24) << (BATCH_MESSAGES / best_zero_copy / 1e6) << std::endl;
+            std::cout.unsetf(std::ios::fixed);
+        }
+    }
+
+    // Pin the calling thread to `cpu` when the machine has that many CPUs.
+    // Cross-core numbers are only meaningful with producer and consumer on
+    // different cores; on smaller machines the threads time-share one core.
+    void pin_to_cpu(unsigned cpu) {
+#ifdef __linux__
+        if (cpu < std::thread::hardware_concurrency()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#else
+        (void)cpu;
+#endif
+    }
+
+    // Spin, then yield if the peer is not making progress (needed when both
+    // threads share a core)
+    inline void backoff(unsigned& spins) {
+        if (++spins > 1024) {
+            std::this_thread::yield();
+            spins = 0;
+        }
+    }
+
+    constexpr size_t CROSS_CORE_MESSAGES = 20'000'000;
+    constexpr size_t ROUND_TRIPS = 200'000;
+
+    // Producer on core 0, consumer on core 1, one element per operation.
+    // Ring memory lives on the consumer's NUMA node (a no-op on one node).
+    template<typename Ring>
+    double benchmark_cross_core_throughput() {
+        static auto ring_ptr = hft::core::make_on_node<Ring>(hft::core::numa_node_of_cpu(1));
+        static Ring& ring = *ring_ptr;
+
+        std::thread consumer([] {
+            pin_to_cpu(1);
+            size_t received = 0;
+            long long checksum = 0;
+            unsigned spins = 0;
+            while (received < CROSS_CORE_MESSAGES) {
+                if (auto item = ring.try_pop()) {
+                    checksum += *item;
+                    ++received;
+                } else {
+                    backoff(spins);
+                }
+            }
+            if (checksum < 0) {
+                std::cout << checksum;
+            }
+        });
+
+        pin_to_cpu(0);
+        auto start = std::chrono::high_resolution_clock::now();
+        unsigned spins = 0;
+        for (size_t i = 0; i < CROSS_CORE_MESSAGES; ++i) {
+            while (!ring.try_push(static_cast<int>(i))) {
+                backoff(spins);
+            }
+        }
+        consumer.join();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return CROSS_CORE_MESSAGES / std::chrono::duration<double>(end - start).count() / 1e6;
+    }
+
+    // Ping-pong between two rings; returns median round trip in nanoseconds
+    template<typename Ring>
+    double benchmark_round_trip() {
+        static auto ping_ptr = hft::core::make_on_node<Ring>(hft::core::numa_node_of_cpu(1));
+        static auto pong_ptr = hft::core::make_on_node<Ring>(hft::core::numa_node_of_cpu(0));
+        static Ring& ping = *ping_ptr;
+        static Ring& pong = *pong_ptr;
+
+        std::thread echo([] {
+            pin_to_cpu(1);
+            unsigned spins = 0;
+            for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+                std::optional<int> item;
+                while (!(item = ping.try_pop())) {
+                    backoff(spins);
+                }
+                while (!pong.try_push(*item)) {
+                    backoff(spins);
+                }
+            }
+        });
+
+        pin_to_cpu(0);
+        std::vector<double> samples;
+        samples.reserve(ROUND_TRIPS);
+        unsigned spins = 0;
+        for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+            auto start = std::chrono::high_resolution_clock::now();
+            while (!ping.try_push(static_cast<int>(i))) {
+                backoff(spins);
+            }
+            while (!pong.try_pop()) {
+                backoff(spins);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+        echo.join();
+
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    void run_cross_core_benchmark() {
+        using Cached = hft::core::RingBuffer<int, BUFFER_SIZE>;
+        using Uncached = baseline::UncachedRingBuffer<int, BUFFER_SIZE>;
+
+        std::cout << "\n=== Cross-Core: Cached vs Uncached Remote Index ===" << std::endl;
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency();
+        if (std::thread::hardware_concurrency() < 2) {
+            std::cout << " (threads share one core - numbers are NOT cross-core)";
+        }
+        std::cout << std::endl;
+        std::cout << "NUMA nodes of CPU 0 / 1: " << hft::core::numa_node_of_cpu(0) << " / "
+                  << hft::core::numa_node_of_cpu(1) << " (rings placed on the consumer's node)" << std::endl << std::endl;
+
+        double before_tp = 0, after_tp = 0;
+        double before_rtt = 1e18, after_rtt = 1e18;
+        for (size_t run = 0; run < 3; ++run) {
+            before_tp = std::max(before_tp, benchmark_cross_core_throughput<Uncached>());
+            after_tp = std::max(after_tp, benchmark_cross_core_throughput<Cached>());
+            before_rtt = std::min(before_rtt, benchmark_round_trip<Uncached>());
+            after_rtt = std::min(after_rtt, benchmark_round_trip<Cached>());
+        }
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << std::setw(30) << "" << std::setw(12) << "Before" << std::setw(12) << "After" << std::endl;
+        std::cout << std::setw(30) << "Throughput (M msgs/s)" << std::setw(12) << before_tp << std::setw(12) << after_tp << std::endl;
+        std::cout << std::setw(30) << "Round trip p50 (ns)" << std::setw(12) << before_rtt << std::setw(12) << after_rtt << std::endl;
+        std::cout.unsetf(std::ios::fixed);
+    }
+
     void run_benchmark() {
         std::cout << "=== HFT Ring Buffer Benchmark ===" << std::endl;
         std::cout << "Buffer Size: " << BUFFER_SIZE << std::endl;
@@ -171,6 +436,8 @@ namespace hft::benchmark {
 int main() {
     try {
         hft::benchmark::run_benchmark();
+        hft::benchmark::run_batch_benchmark();
+        hft::benchmark::run_cross_core_benchmark();
         return 0;
     }
     catch (const std::exception& e) {
@@ -0,0 +1,285 @@
+#include "shm_ring_buffer.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Cross-process benchmark for ShmRingBuffer
+//
+// Parent and child are separate processes (fork) that share rings only through
+// a POSIX shared-memory mapping, as a feed handler and a strategy would.
+namespace hft::benchmark {
+
+    // Stand-in for a decoded ITCH event (fixed-size, trivially copyable)
+    struct Event {
+        uint64_t sequence;
+        int64_t send_ns;
+        uint64_t payload[2];
+    };
+
+    constexpr size_t RING_SIZE = 4096;  // Power of 2
+    constexpr size_t NUM_ROUND_TRIPS = 100'000;
+    constexpr size_t NUM_MESSAGES = 5'000'000;
+
+    using Ring = hft::core::ShmRingBuffer<Event, RING_SIZE>;
+
+    int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Spin briefly, then yield: on a box with fewer cores than spinning
+    // processes a pure spin would burn the peer's whole timeslice.
+    inline void backoff(uint32_t& spins) {
+        if (++spins > 256) {
+            std::this_thread::yield();
+            spins = 0;
+        }
+    }
+
+    std::string region_name(const char* tag) {
+        return "/hft_shm_ring_bench_" + std::to_string(getpid()) + "_" + tag;
+    }
+
+    // Benchmark: ping-pong round-trip latency between two processes
+    void benchmark_round_trip() {
+        const std::string ping_name = region_name("ping");
+        const std::string pong_name = region_name("pong");
+        auto ping_region = hft::core::SharedMemoryRegion::create(ping_name, sizeof(Ring));
+        auto pong_region = hft::core::SharedMemoryRegion::create(pong_name, sizeof(Ring));
+        if (!ping_region || !pong_region) {
+            throw std::runtime_error("shm_open failed");
+        }
+        Ring* ping = Ring::create(ping_region->data());
+        Ring* pong = Ring::create(pong_region->data());
+
+        pid_t child = fork();
+        if (child < 0) {
+            throw std::runtime_error("fork failed");
+        }
+        if (child == 0) {
+            // Echo process: attach by name like an unrelated process would.
+            // The new mappings land at different addresses than the parent's.
+            auto ping_map = hft::core::SharedMemoryRegion::open(ping_name);
+            auto pong_map = hft::core::SharedMemoryRegion::open(pong_name);
+            if (!ping_map || !pong_map) {
+                _exit(1);
+            }
+            Ring* in = Ring::attach(ping_map->data(), ping_map->size());
+            Ring* out = Ring::attach(pong_map->data(), pong_map->size());
+            if (!in || !out) {
+                _exit(1);
+            }
+            in->register_consumer();
+            out->register_producer();
+            for (size_t i = 0; i < NUM_ROUND_TRIPS; ++i) {
+                uint32_t spins = 0;
+                std::optional<Event> e;
+                while (!(e = in->try_pop())) {
+                    backoff(spins);
+                }
+                while (!out->try_push(*e)) {
+                    backoff(spins);
+                }
+            }
+            _exit(0);
+        }
+
+        ping->register_producer();
+        pong->register_consumer();
+
+        std::vector<int64_t> rtt;
+        rtt.reserve(NUM_ROUND_TRIPS);
+        for (size_t i = 0; i < NUM_ROUND_TRIPS; ++i) {
+            Event e{i, now_ns(), {0, 0}};
+            uint32_t spins = 0;
+            while (!ping->try_push(e)) {
+                backoff(spins);
+            }
+            std::optional<Event> reply;
+            while (!(reply = pong->try_pop())) {
+                backoff(spins);
+            }
+            if (reply->sequence != i) {
+                throw std::runtime_error("round trip out of order");
+            }
+            rtt.push_back(now_ns() - reply->send_ns);
+        }
+        waitpid(child, nullptr, 0);
+
+        std::sort(rtt.begin(), rtt.end());
+        auto pct = [&](double p) { return rtt[static_cast<size_t>(p * (rtt.size() - 1))]; };
+        std::cout << "\nRound-trip latency (" << NUM_ROUND_TRIPS << " ping-pongs):" << std::endl;
+        std::cout << "  p50:   " << pct(0.50) << " ns" << std::endl;
+        std::cout << "  p99:   " << pct(0.99) << " ns" << std::endl;
+        std::cout << "  p99.9: " << pct(0.999) << " ns" << std::endl;
+        std::cout << "  max:   " << rtt.back() << " ns" << std::endl;
+    }
+
+    // Benchmark: one-way streaming throughput producer process -> consumer process
+    void benchmark_throughput() {
+        auto region = hft::core::SharedMemoryRegion::create(region_name("stream"), sizeof(Ring));
+        if (!region) {
+            throw std::runtime_error("shm_open failed");
+        }
+        Ring* ring = Ring::create(region->data());
+
+        pid_t child = fork();
+        if (child < 0) {
+            throw std::runtime_error("fork failed");
+        }
+        if (child == 0) {
+            ring->register_consumer();
+            uint64_t expected = 0;
+            uint32_t spins = 0;
+            while (expected < NUM_MESSAGES) {
+                if (auto e = ring->try_pop()) {
+                    if (e->sequence != expected) {
+                        _exit(1);  // Lost or reordered event
+                    }
+                    ++expected;
+                } else {
+                    backoff(spins);
+                }
+            }
+            _exit(0);
+        }
+
+        ring->register_producer();
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < NUM_MESSAGES; ++i) {
+            Event e{i, 0, {i, i}};
+            uint32_t spins = 0;
+            while (!ring->try_push(e)) {
+                backoff(spins);
+            }
+        }
+        ring->close_producer();
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        auto end = std::chrono::steady_clock::now();
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            throw std::runtime_error("consumer saw events out of order");
+        }
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        std::cout << "\nThroughput (" << NUM_MESSAGES << " x " << sizeof(Event) << "-byte events):" << std::endl;
+        std::cout << "  Time:       " << seconds << "s" << std::endl;
+        std::cout << "  Throughput: " << (NUM_MESSAGES / seconds / 1e6) << " M msgs/s" << std::endl;
+    }
+
+    // Check: a consumer that dies is detected by the producer
+    void check_crash_detection() {
+        auto region = hft::core::SharedMemoryRegion::create(region_name("crash"), sizeof(Ring));
+        if (!region) {
+            throw std::runtime_error("shm_open failed");
+        }
+        Ring* ring = Ring::create(region->data());
+
+        pid_t child = fork();
+        if (child == 0) {
+            ring->register_consumer();
+            pause();  // Wait to be killed
+            _exit(0);
+        }
+
+        while (ring->header().consumer_pid.load(std::memory_order_acquire) != child) {
+            std::this_thread::yield();
+        }
+        bool alive_before = ring->consumer_alive();
+        kill(child, SIGKILL);
+        waitpid(child, nullptr, 0);  // Reap so the pid no longer exists
+        bool alive_after = ring->consumer_alive();
+
+        std::cout << "\nCrash detection:" << std::endl;
+        std::cout << "  Consumer alive before kill: " << (alive_before ? "yes" : "no") << std::endl;
+        std::cout << "  Consumer alive after kill:  " << (alive_after ? "yes" : "no") << std::endl;
+        if (!alive_before || alive_after) {
+            throw std::runtime_error("crash detection failed");
+        }
+
+        // A mismatched element type must be refused on attach
+        using WrongRing = hft::core::ShmRingBuffer<uint64_t, RING_SIZE>;
+        if (WrongRing::attach(region->data(), region->size()) != nullptr) {
+            throw std::runtime_error("attach accepted a ring of a different type");
+        }
+        std::cout << "  Attach with wrong element type rejected" << std::endl;
+    }
+
+    // Check: create() never takes the name from a ring whose owner is alive
+    void check_single_owner() {
+        const std::string name = region_name("owner");
+        auto region = hft::core::SharedMemoryRegion::create(name, sizeof(Ring));
+        if (!region) {
+            throw std::runtime_error("shm_open failed");
+        }
+        Ring::create(region->data())->register_producer();
+
+        // A second creator in another process must be refused while we live
+        pid_t child = fork();
+        if (child == 0) {
+            auto second = hft::core::SharedMemoryRegion::create(name, sizeof(Ring));
+            _exit(second ? 1 : 0);  // _exit: never run the parent's region destructor
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        const bool refused = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+        // An owner that dies without its destructor leaves a stale segment behind
+        const std::string stale_name = region_name("stale");
+        child = fork();
+        if (child == 0) {
+            auto crashed = hft::core::SharedMemoryRegion::create(stale_name, sizeof(Ring));
+            if (!crashed) {
+                _exit(1);
+            }
+            Ring::create(crashed->data())->register_producer();
+            _exit(0);  // Skips shm_unlink, like a crash
+        }
+        waitpid(child, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            throw std::runtime_error("stale-owner child failed to create its ring");
+        }
+        auto replacement = hft::core::SharedMemoryRegion::create(stale_name, sizeof(Ring));
+
+        std::cout << "\nSingle owner per name:" << std::endl;
+        std::cout << "  Second create while owner alive: " << (refused ? "refused" : "ACCEPTED") << std::endl;
+        std::cout << "  Create over a dead owner's ring:  " << (replacement ? "replaced" : "REFUSED") << std::endl;
+        if (!refused || !replacement) {
+            throw std::runtime_error("single-owner check failed");
+        }
+    }
+
+    void run_benchmark() {
+        std::cout << "=== HFT Shared-Memory Ring Buffer Benchmark ===" << std::endl;
+        std::cout << "Ring Size: " << RING_SIZE << " x " << sizeof(Event) << " bytes" << std::endl;
+        std::cout << "Segment Size: " << sizeof(Ring) << " bytes" << std::endl;
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+        benchmark_round_trip();
+        benchmark_throughput();
+        check_crash_detection();
+        check_single_owner();
+    }
+}
+
+int main() {
+    try {
+        hft::benchmark::run_benchmark();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,139 @@
+#include "ring_buffer.hpp"
+#include "wait_strategy.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+
+#if defined(__unix__)
+#include <time.h>
+#endif
+
+// Wait strategy benchmark: wake-up latency vs. CPU burned by an idle consumer
+//
+// The producer publishes one timestamped event every PACING (200 us)
+// and sleeps in between, like a quiet symbol's market data. The consumer
+// waits with each strategy in turn; we record publish-to-receive latency and
+// the consumer thread's CPU time as a fraction of wall time.
+namespace hft::benchmark {
+
+    struct Event {
+        uint64_t sequence;
+        int64_t send_ns;
+    };
+
+    constexpr size_t RING_SIZE = 1024;  // Power of 2
+    constexpr size_t NUM_EVENTS = 2'000;
+    constexpr auto PACING = std::chrono::microseconds(200);
+
+    using Ring = hft::core::RingBuffer<Event, RING_SIZE>;
+
+    int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /// CPU time consumed by the calling thread (0 where unsupported)
+    int64_t thread_cpu_ns() {
+#if defined(__unix__)
+        timespec ts{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+#else
+        return 0;
+#endif
+    }
+
+    struct WaitResult {
+        std::string name;
+        int64_t p50;
+        int64_t p99;
+        int64_t max;
+        double cpu_percent;
+    };
+
+    template<typename Strategy>
+    WaitResult benchmark_strategy(const std::string& name) {
+        auto ring = std::make_unique<Ring>();
+        Strategy strategy;
+        std::vector<int64_t> latencies;
+        latencies.reserve(NUM_EVENTS);
+        int64_t consumer_cpu_ns = 0;
+        int64_t consumer_wall_ns = 0;
+
+        std::thread consumer([&]() {
+            const int64_t wall_start = now_ns();
+            const int64_t cpu_start = thread_cpu_ns();
+            for (size_t i = 0; i < NUM_EVENTS; ++i) {
+                Event e = ring->pop_wait(strategy);
+                latencies.push_back(now_ns() - e.send_ns);
+            }
+            consumer_cpu_ns = thread_cpu_ns() - cpu_start;
+            consumer_wall_ns = now_ns() - wall_start;
+        });
+
+        for (uint64_t i = 0; i < NUM_EVENTS; ++i) {
+            std::this_thread::sleep_for(PACING);
+            while (!ring->try_push(Event{ i, now_ns() })) {
+                std::this_thread::yield();
+            }
+            strategy.notify();
+        }
+        consumer.join();
+
+        std::sort(latencies.begin(), latencies.end());
+        auto pct = [&](double p) { return latencies[static_cast<size_t>(p * (latencies.size() - 1))]; };
+        return { name, pct(0.50), pct(0.99), latencies.back(),
+                 100.0 * static_cast<double>(consumer_cpu_ns) / static_cast<double>(consumer_wall_ns) };
+    }
+
+    void run_benchmark() {
+        std::cout << "=== HFT Ring Buffer Wait Strategy Benchmark ===" << std::endl;
+        std::cout << "Events: " << NUM_EVENTS << ", one every "
+                  << PACING.count() << " us (producer sleeps in between)" << std::endl;
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+        if (std::thread::hardware_concurrency() < 2) {
+            std::cout << "WARNING: single hardware thread - a spinning consumer competes with the\n"
+                      << "         producer for the only core, so spin latencies are scheduler-bound." << std::endl;
+        }
+
+        std::vector<WaitResult> results;
+        results.push_back(benchmark_strategy<hft::core::BusySpinWait>("Busy-spin"));
+        results.push_back(benchmark_strategy<hft::core::PauseSpinWait>("Spin + PAUSE"));
+        results.push_back(benchmark_strategy<hft::core::YieldWait>("Spin + yield"));
+        results.push_back(benchmark_strategy<hft::core::FutexWait>("Futex (spin then sleep)"));
+
+        std::cout << "\n" << std::string(72, '=') << std::endl;
+        std::cout << std::left << std::setw(26) << "Strategy"
+                  << std::right << std::setw(11) << "p50 (ns)"
+                  << std::setw(11) << "p99 (ns)"
+                  << std::setw(12) << "max (ns)"
+                  << std::setw(12) << "CPU burn" << std::endl;
+        std::cout << std::string(72, '-') << std::endl;
+        for (const auto& r : results) {
+            std::cout << std::left << std::setw(26) << r.name
+                      << std::right << std::setw(11) << r.p50
+                      << std::setw(11) << r.p99
+                      << std::setw(12) << r.max
+                      << std::setw(11) << std::fixed << std::setprecision(1) << r.cpu_percent << "%"
+                      << std::endl;
+        }
+        std::cout << std::string(72, '=') << std::endl;
+    }
+}
+
+int main() {
+    try {
+        hft::benchmark::run_benchmark();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "thread_registry.hpp"
+
+namespace hft::memory {
+
+    /**
+     * @brief Fixed-capacity memory pool shared by many threads
+     *
+     * MemoryPool's intrusive free list, split in two tiers (tcmalloc /
+     * jemalloc tcache style):
+     * - Per-thread caches: allocate/deallocate are plain pointer pushes and
+     *   pops on the calling thread's own list - no atomics, no sharing.
+     * - Central depot: a lock-free stack of batches of BatchSize free slots.
+     *   A cache that runs dry pops one batch; a cache that reaches
+     *   2 * BatchSize pushes one batch back. One CAS per BatchSize operations.
+     *
+     * Cross-thread frees (an order allocated by the feed thread and released
+     * by a consumer) simply land in the freeing thread's cache; slots are
+     * interchangeable, and the surplus flows back through the depot to the
+     * thread that keeps allocating.
+     *
+     * The depot head is an {ABA tag, batch index} pair updated with a 64-bit
+     * CAS, so a batch popped and re-pushed between a competitor's load and
+     * CAS cannot be mistaken for the original.
+     *
+     * Thread Safety: allocate/deallocate from any thread. Slots stranded in
+     * another thread's cache are not visible to allocate(); call
+     * flush_thread_cache() from threads that stop allocating.
+     *
+     * @tparam T Type of objects to pool
+     * @tparam PoolSize Maximum number of objects in the pool
+     * @tparam BatchSize Slots moved between a thread cache and the depot at once
+     *
+     * Example usage:
+     * @code
+     * ConcurrentMemoryPool<Order, 65536> order_pool;
+     *
+     * // Feed thread
+     * Order* order = order_pool.allocate(order_id, price, quantity);
+     * queue.push(order);
+     *
+     * // Consumer thread
+     * order_pool.deallocate(queue.pop());
+     * @endcode
+     */
+    template<typename T, size_t PoolSize, size_t BatchSize = 32>
+    class ConcurrentMemoryPool {
+    public:
+        static_assert(PoolSize > 0, "Pool size must be greater than zero");
+        static_assert(BatchSize > 0 && PoolSize % BatchSize == 0,
+            "Pool size must be a multiple of the batch size (depot holds full batches only)");
+        static_assert(PoolSize < UINT32_MAX, "Slot indices are 32-bit");
+
+        ConcurrentMemoryPool() {
+            storage_ = static_cast<std::byte*>(
+                ::operator new(sizeof(Slot) * PoolSize, std::align_val_t{alignof(Slot)})
+            );
+
+            // Carve the storage into batches and stack them all in the depot
+            uint32_t head = EMPTY;
+            for (size_t b = PoolSize / BatchSize; b-- > 0;) {
+                Slot* first = slot_at(b * BatchSize);
+                for (size_t i = 0; i < BatchSize - 1; ++i) {
+                    slot_at(b * BatchSize + i)->free.next = slot_at(b * BatchSize + i + 1);
+                }
+                slot_at(b * BatchSize + BatchSize - 1)->free.next = nullptr;
+                first->free.next_batch = head;
+                head = static_cast<uint32_t>(b * BatchSize);
+            }
+            depot_head_.store(head, std::memory_order_relaxed);
+            depot_batches_.store(PoolSize / BatchSize, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Destructor - frees the entire memory block
+         *
+         * WARNING: Does NOT call destructors on allocated objects, and no
+         * thread may still be using the pool.
+         */
+        ~ConcurrentMemoryPool() noexcept {
+            ::operator delete(storage_, std::align_val_t{alignof(Slot)});
+        }
+
+        ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+        ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+        ConcurrentMemoryPool(ConcurrentMemoryPool&&) = delete;
+        ConcurrentMemoryPool& operator=(ConcurrentMemoryPool&&) = delete;
+
+        /**
+         * @brief Allocate and construct an object (any thread)
+         *
+         * @return Pointer to constructed object, or nullptr if neither this
+         *         thread's cache nor the depot has a free slot
+         */
+        template<typename... Args>
+        [[nodiscard]] T* allocate(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+            Slot* slot = with_cache([this](LocalCache& cache) -> Slot* {
+                if (cache.head == nullptr) {
+                    cache.head = pop_batch();
+                    if (cache.head == nullptr) {
+                        return nullptr;  // Exhausted (or stranded in other caches)
+                    }
+                    cache.count = BatchSize;
+                }
+                Slot* s = cache.head;
+                cache.head = s->free.next;
+                --cache.count;
+                return s;
+            });
+            if (slot == nullptr) {
+                return nullptr;
+            }
+            return new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Destruct and return an object to the pool (any thread)
+         *
+         * The slot goes to the calling thread's cache, not necessarily the
+         * allocating thread's.
+         */
+        void deallocate(T* object) noexcept {
+            if (object == nullptr) {
+                return;
+            }
+            object->~T();
+            Slot* slot = reinterpret_cast<Slot*>(object);
+
+            with_cache([this, slot](LocalCache& cache) {
+                slot->free.next = cache.head;
+                cache.head = slot;
+                if (++cache.count == 2 * BatchSize) {
+                    push_batch(detach_batch(cache));
+                }
+                return 0;
+            });
+        }
+
+        /// Return this thread's cached slots to the depot (whole batches)
+        void flush_thread_cache() noexcept {
+            with_cache([this](LocalCache& cache) {
+                while (cache.count >= BatchSize) {
+                    push_batch(detach_batch(cache));
+                }
+                return 0;
+            });
+        }
+
+        /// Approximate number of free batches in the depot
+        [[nodiscard]] size_t depot_batches() const noexcept {
+            return depot_batches_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] constexpr size_t capacity() const noexcept {
+            return PoolSize;
+        }
+
+        [[nodiscard]] static constexpr size_t batch_size() noexcept {
+            return BatchSize;
+        }
+
+    private:
+        static constexpr uint32_t EMPTY = UINT32_MAX;
+
+        union Slot;
+
+        struct FreeHeader {
+            Slot* next;           // Next free slot in this cache / batch
+            uint32_t next_batch;  // Depot link (valid on a batch's first slot)
+        };
+
+        union Slot {
+            T object;
+            FreeHeader free;
+
+            Slot() {}
+            ~Slot() {}
+        };
+
+        struct alignas(64) LocalCache {
+            Slot* head{ nullptr };
+            size_t count{ 0 };
+        };
+
+        Slot* slot_at(size_t index) const noexcept {
+            return reinterpret_cast<Slot*>(storage_ + index * sizeof(Slot));
+        }
+
+        uint32_t index_of(const Slot* slot) const noexcept {
+            return static_cast<uint32_t>(
+                (reinterpret_cast<const std::byte*>(slot) - storage_) / sizeof(Slot));
+        }
+
+        /// Run `op` on this thread's cache (or the shared overflow cache)
+        template<typename Op>
+        auto with_cache(Op&& op) noexcept {
+            const size_t id = this_thread_index();
+            if (id != NO_THREAD_INDEX) {
+                return op(caches_[id]);
+            }
+            // More than MAX_REGISTERED_THREADS live threads: share one locked cache
+            while (overflow_lock_.test_and_set(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            auto result = op(overflow_cache_);
+            overflow_lock_.clear(std::memory_order_release);
+            return result;
+        }
+
+        /// Split the first BatchSize slots off a cache holding at least that many
+        Slot* detach_batch(LocalCache& cache) noexcept {
+            Slot* first = cache.head;
+            Slot* last = first;
+            for (size_t i = 1; i < BatchSize; ++i) {
+                last = last->free.next;
+            }
+            cache.head = last->free.next;
+            last->free.next = nullptr;
+            cache.count -= BatchSize;
+            return first;
+        }
+
+        void push_batch(Slot* batch) noexcept {
+            const uint64_t index = index_of(batch);
+            uint64_t head = depot_head_.load(std::memory_order_relaxed);
+            uint64_t desired;
+            do {
+                std::atomic_ref<uint32_t>(batch->free.next_batch)
+                    .store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+                desired = (((head >> 32) + 1) << 32) | index;
+            } while (!depot_head_.compare_exchange_weak(head, desired,
+                         std::memory_order_release, std::memory_order_relaxed));
+            depot_batches_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Slot* pop_batch() noexcept {
+            uint64_t head = depot_head_.load(std::memory_order_acquire);
+            while (true) {
+                const uint32_t index = static_cast<uint32_t>(head);
+                if (index == EMPTY) {
+                    return nullptr;
+                }
+                Slot* batch = slot_at(index);
+                // May read a batch another thread just popped and reused; the
+                // tag makes our CAS fail in that case and the value is discarded
+                const uint64_t next = std::atomic_ref<uint32_t>(batch->free.next_batch)
+                    .load(std::memory_order_relaxed);
+                const uint64_t desired = (((head >> 32) + 1) << 32) | next;
+                if (depot_head_.compare_exchange_weak(head, desired,
+                        std::memory_order_acquire, std::memory_order_acquire)) {
+                    depot_batches_.fetch_sub(1, std::memory_order_relaxed);
+                    return batch;
+                }
+            }
+        }
+
+        static_assert(alignof(Slot) >= alignof(T), "Alignment mismatch");
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "Depot head needs a lock-free 64-bit CAS");
+
+        std::byte* storage_{ nullptr };
+
+        // Depot: {tag:32, index:32} of the first batch
+        alignas(64) std::atomic<uint64_t> depot_head_{ EMPTY };
+        std::atomic<size_t> depot_batches_{ 0 };
+
+        alignas(64) std::array<LocalCache, MAX_REGISTERED_THREADS> caches_{};
+
+        LocalCache overflow_cache_;
+        std::atomic_flag overflow_lock_ = ATOMIC_FLAG_INIT;
+    };
+
+} // namespace hft::memory
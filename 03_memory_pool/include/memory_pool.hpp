@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <new>
 #include <stdexcept>
+#include "backing_memory.hpp"
 
 namespace hft::memory {
 
@@ -61,25 +62,29 @@ namespace hft::memory {
             storage_ = static_cast<std::byte*>(
                 ::operator new(sizeof(Slot) * PoolSize, std::align_val_t{alignof(Slot)})
             );
-            
-            // Initialize free list: link all slots together
-            // Each slot points to the next available slot
-            free_list_ = reinterpret_cast<Slot*>(storage_);
-            
-            Slot* current = free_list_;
-            for (size_t i = 0; i < PoolSize - 1; ++i) {
-                // Get pointer to next slot in array
-                Slot* next = reinterpret_cast<Slot*>(
-                    storage_ + (i + 1) * sizeof(Slot)
-                );
-                current->next = next;
-                current = next;
-            }
-            
-            // Last slot points to nullptr (end of free list)
-            current->next = nullptr;
-            
-            available_count_ = PoolSize;
+            init_free_list();
+        }
+        
+        /**
+         * @brief Construct the pool on a dedicated mapping (huge pages, pre-faulted, locked)
+         * 
+         * Same pool, but the slots live in a MappedRegion instead of the heap,
+         * so a large pool costs a handful of TLB entries and no page faults
+         * after construction. Set numa_node to the owning thread's node so the
+         * slots are local to it even if another thread builds the pool. See
+         * MappedRegion for how each option degrades.
+         * 
+         * Example:
+         * @code
+         * MemoryPool<Order, 1'000'000> pool({ HugePages::TRANSPARENT, true, true });
+         * MemoryPool<Order, 1'000'000> node1_pool({ HugePages::TRANSPARENT, true, false, 1 });
+         * @endcode
+         */
+        explicit MemoryPool(BackingOptions backing)
+            : region_(sizeof(Slot) * PoolSize, backing) {
+            static_assert(alignof(Slot) <= MappedRegion::PAGE_SIZE, "Slot alignment exceeds page size");
+            storage_ = static_cast<std::byte*>(region_.data());
+            init_free_list();
         }
         
         /**
@@ -90,8 +95,10 @@ namespace hft::memory {
          */
         ~MemoryPool() noexcept {
             // In debug builds, could check if all objects were returned
-            // For now, just free the memory
-            ::operator delete(storage_, std::align_val_t{alignof(Slot)});
+            // For now, just free the memory (a mapped region unmaps itself)
+            if (region_.data() == nullptr) {
+                ::operator delete(storage_, std::align_val_t{alignof(Slot)});
+            }
         }
         
         // Prevent copying and moving (pools should be stationary)
@@ -203,7 +210,49 @@ namespace hft::memory {
             return available_count_ == PoolSize;
         }
         
+        /**
+         * @brief Check whether `pointer` lies in this pool's storage
+         * 
+         * Two compares, no free-list walk: lets callers that mix pooled and
+         * heap objects (e.g. PoolAllocator on exhaustion) route a pointer back
+         * to the right place.
+         */
+        [[nodiscard]] bool owns(const void* pointer) const noexcept {
+            const auto* bytes = static_cast<const std::byte*>(pointer);
+            return bytes >= storage_ && bytes < storage_ + sizeof(Slot) * PoolSize;
+        }
+        
+        /**
+         * @brief NUMA node the slots are bound to
+         * @return ANY_NUMA_NODE for heap-backed pools or if binding was unavailable
+         */
+        [[nodiscard]] int numa_node() const noexcept {
+            return region_.numa_node();
+        }
+        
     private:
+        /// Link every slot into the free list (constructors only)
+        void init_free_list() noexcept {
+            // Initialize free list: link all slots together
+            // Each slot points to the next available slot
+            free_list_ = reinterpret_cast<Slot*>(storage_);
+            
+            Slot* current = free_list_;
+            for (size_t i = 0; i < PoolSize - 1; ++i) {
+                // Get pointer to next slot in array
+                Slot* next = reinterpret_cast<Slot*>(
+                    storage_ + (i + 1) * sizeof(Slot)
+                );
+                current->next = next;
+                current = next;
+            }
+            
+            // Last slot points to nullptr (end of free list)
+            current->next = nullptr;
+            
+            available_count_ = PoolSize;
+        }
+        
         /**
          * @brief Union for memory reuse trick
          * 
@@ -233,6 +282,9 @@ namespace hft::memory {
         // Pool storage: one contiguous block of memory
         std::byte* storage_{nullptr};
         
+        // Owns storage_ when constructed with BackingOptions (empty otherwise)
+        MappedRegion region_;
+        
         // Free list: singly-linked list of available slots
         // Head of the list (next slot to allocate)
         Slot* free_list_{nullptr};
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "backing_memory.hpp"  // ANY_NUMA_NODE
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace hft::memory {
+
+    /**
+     * @class Topology
+     * @brief NUMA nodes and their CPUs, plus pinning of pipeline threads.
+     *
+     * The feed handler, book builder and strategy threads should run on
+     * cores of one node and build their books / pools / rings from that
+     * node's memory (BackingOptions::numa_node). Typical wiring:
+     *
+     * @code
+     * auto topology = Topology::detect();
+     * auto cpus = topology.assign_cpus(0, 2);          // Feed + book thread
+     *
+     * std::thread book_thread = Topology::start_pinned(cpus[1], [&] {
+     *     BackingOptions backing;
+     *     backing.numa_node = topology.current_node();  // Node it now runs on
+     *     MemoryPool<Order, 100000> pool(backing);
+     *     // ... consume
+     * });
+     * @endcode
+     *
+     * Testable without NUMA hardware: detect() takes the sysfs root, so a
+     * test can point it at a fake directory tree, or build a Topology from
+     * a node list directly.
+     *
+     * detect() keeps only CPUs in the process's affinity mask (taskset,
+     * cgroup cpusets, isolcpus tooling): a node whose CPUs are all excluded
+     * is dropped, so assign_cpus() never hands out a CPU pinning would
+     * refuse. system() keeps every CPU, for lookups.
+     *
+     * Degrades instead of failing: no NUMA sysfs -> one node with every
+     * usable CPU; fewer CPUs on a node than threads -> CPUs are shared;
+     * pinning to a CPU the process may not use -> returns false and the
+     * thread stays unpinned; unknown node -> ANY_NUMA_NODE, i.e. first-touch
+     * placement.
+     */
+    class Topology {
+    public:
+        struct Node {
+            int id;
+            std::vector<int> cpus;
+        };
+
+        /// Build from an explicit node list (tests, or placement from config).
+        /// Nodes without CPUs are dropped; an empty list becomes node 0 / CPU 0.
+        explicit Topology(std::vector<Node> nodes) : nodes_(std::move(nodes)) {
+            std::erase_if(nodes_, [](const Node& node) { return node.cpus.empty(); });
+            std::sort(nodes_.begin(), nodes_.end(), [](const Node& a, const Node& b) { return a.id < b.id; });
+            if (nodes_.empty()) {
+                nodes_.push_back({0, {0}});
+            }
+        }
+
+        /**
+         * @brief Read the machine's topology
+         * @param sysfs_root Normally /sys/devices/system; tests pass a fake tree
+         *        with node/node<N>/cpulist and cpu/online files
+         * @param allowed CPUs the process may run on (default: allowed_cpus());
+         *        empty = no restriction
+         */
+        static Topology detect(const std::filesystem::path& sysfs_root = "/sys/devices/system",
+                               const std::vector<int>& allowed = allowed_cpus()) {
+            auto usable = [&](std::vector<int> cpus) {
+                if (!allowed.empty()) {
+                    std::erase_if(cpus, [&](int cpu) {
+                        return std::find(allowed.begin(), allowed.end(), cpu) == allowed.end();
+                    });
+                }
+                return cpus;
+            };
+
+            std::vector<Node> nodes;
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(sysfs_root / "node", ec)) {
+                const std::string name = entry.path().filename().string();
+                int id = -1;
+                if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+                    std::from_chars(name.data() + 4, name.data() + name.size(), id).ec != std::errc{}) {
+                    continue;
+                }
+                // Memory-only nodes, and nodes outside the affinity mask, are dropped below
+                nodes.push_back({id, usable(parse_cpulist(read_line(entry.path() / "cpulist")))});
+            }
+            std::erase_if(nodes, [](const Node& node) { return node.cpus.empty(); });
+            if (nodes.empty()) {
+                // No NUMA support: a single node with every usable online CPU
+                auto cpus = usable(parse_cpulist(read_line(sysfs_root / "cpu" / "online")));
+                if (cpus.empty()) {
+                    cpus = allowed;
+                }
+                if (cpus.empty()) {
+                    for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+                        cpus.push_back(static_cast<int>(cpu));
+                    }
+                }
+                nodes.push_back({0, std::move(cpus)});
+            }
+            return Topology(std::move(nodes));
+        }
+
+        /**
+         * @brief The whole machine, detected once: for CPU -> node lookups
+         *
+         * Not filtered by the affinity mask, so node_of_cpu() answers for any
+         * CPU and the result does not depend on which (possibly pinned) thread
+         * asked first. Use detect() to pick CPUs for assign_cpus().
+         */
+        static const Topology& system() {
+            static const Topology topology = detect("/sys/devices/system", {});
+            return topology;
+        }
+
+        /// CPUs in the calling thread's affinity mask (empty if unavailable)
+        ///
+        /// Call before pinning - e.g. from main() - to get the process-wide set.
+        static std::vector<int> allowed_cpus() {
+            std::vector<int> cpus;
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &set)) {
+                        cpus.push_back(cpu);
+                    }
+                }
+            }
+#endif
+            return cpus;
+        }
+
+        /// Parse a kernel CPU list such as "0-3,8,10-11"
+        static std::vector<int> parse_cpulist(std::string_view list) {
+            std::vector<int> cpus;
+            while (!list.empty()) {
+                const size_t comma = list.find(',');
+                std::string_view range = list.substr(0, comma);
+                list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+                int first = 0;
+                auto [end, ec] = std::from_chars(range.data(), range.data() + range.size(), first);
+                if (ec != std::errc{}) {
+                    continue;
+                }
+                int last = first;
+                if (end != range.data() + range.size() && *end == '-') {
+                    std::from_chars(end + 1, range.data() + range.size(), last);
+                }
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+            return cpus;
+        }
+
+        const std::vector<Node>& nodes() const noexcept { return nodes_; }
+        size_t node_count() const noexcept { return nodes_.size(); }
+        bool is_numa() const noexcept { return nodes_.size() > 1; }
+
+        /// Node owning `cpu`, or ANY_NUMA_NODE if the CPU is unknown
+        int node_of_cpu(int cpu) const noexcept {
+            for (const auto& node : nodes_) {
+                if (std::find(node.cpus.begin(), node.cpus.end(), cpu) != node.cpus.end()) {
+                    return node.id;
+                }
+            }
+            return ANY_NUMA_NODE;
+        }
+
+        /// Node of the CPU the calling thread runs on (stable once pinned)
+        int current_node() const noexcept {
+#if defined(__linux__)
+            const int cpu = sched_getcpu();
+            return cpu < 0 ? ANY_NUMA_NODE : node_of_cpu(cpu);
+#else
+            return ANY_NUMA_NODE;
+#endif
+        }
+
+        /**
+         * @brief `count` CPUs on `node` for pipeline threads, one per thread
+         *
+         * Uses the node's CPUs from the highest down, leaving the low ones
+         * (where the kernel and IRQs usually land) for housekeeping. Wraps
+         * around if the node has fewer CPUs than requested; an unknown node
+         * falls back to the first node.
+         */
+        std::vector<int> assign_cpus(int node, size_t count) const {
+            const Node* chosen = &nodes_.front();
+            for (const auto& n : nodes_) {
+                if (n.id == node) {
+                    chosen = &n;
+                }
+            }
+            std::vector<int> cpus;
+            cpus.reserve(count);
+            const size_t available = chosen->cpus.size();
+            for (size_t i = 0; i < count; ++i) {
+                cpus.push_back(chosen->cpus[available - 1 - (i % available)]);
+            }
+            return cpus;
+        }
+
+        /// Pin the calling thread to `cpu`. False (thread left as is) if not allowed.
+        static bool pin_current_thread(int cpu) noexcept {
+#if defined(__linux__)
+            if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                return false;
+            }
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+            (void)cpu;
+            return false;
+#endif
+        }
+
+        /// Start a thread that pins itself to `cpu` before running `fn`
+        ///
+        /// Pinning happens on the new thread, before `fn` allocates anything,
+        /// so first-touch and current_node() both see the right node.
+        template <typename Fn>
+        static std::thread start_pinned(int cpu, Fn&& fn) {
+            return std::thread([cpu, fn = std::forward<Fn>(fn)]() mutable {
+                (void)pin_current_thread(cpu);
+                fn();
+            });
+        }
+
+    private:
+        static std::string read_line(const std::filesystem::path& path) {
+            std::ifstream file(path);
+            std::string line;
+            std::getline(file, line);
+            return line;
+        }
+
+        std::vector<Node> nodes_;
+    };
+
+} // namespace hft::memory
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "memory_pool.hpp"
+
+namespace hft::memory {
+
+    namespace detail {
+
+        /**
+         * @brief Raw storage for one container node
+         *
+         * The user-provided empty constructor keeps MemoryPool::allocate()
+         * from zeroing the bytes; the container constructs the real node
+         * in them right after.
+         */
+        template<size_t Size, size_t Align>
+        struct alignas(Align) NodeBlock {
+            std::byte bytes[Size];
+            NodeBlock() {}
+        };
+
+        /// Unique address per pool type, used as a lookup key
+        template<typename Pool>
+        inline constexpr char pool_key = 0;
+
+        /**
+         * @brief Pools shared by every copy (and rebind) of one PoolAllocator
+         *
+         * A container rebinds its allocator to node types it never names
+         * (hash nodes, tree nodes, bucket arrays), so the pools cannot be
+         * chosen up front. Each distinct node size/alignment gets its own
+         * MemoryPool, created on its first single-object allocation. Types
+         * with the same size and alignment share one pool.
+         */
+        template<size_t PoolSize>
+        class PoolSet {
+        public:
+            PoolSet() = default;
+            explicit PoolSet(BackingOptions backing) : backing_(backing) {}
+
+            ~PoolSet() noexcept {
+                for (const auto& entry : pools_) {
+                    entry.destroy(entry.pool);
+                }
+            }
+
+            PoolSet(const PoolSet&) = delete;
+            PoolSet& operator=(const PoolSet&) = delete;
+
+            /// Existing pool of this type, or nullptr
+            template<typename Pool>
+            Pool* find() const noexcept {
+                for (const auto& entry : pools_) {
+                    if (entry.key == &pool_key<Pool>) {
+                        return static_cast<Pool*>(entry.pool);
+                    }
+                }
+                return nullptr;
+            }
+
+            /// Pool of this type, created on first use
+            template<typename Pool>
+            Pool* get() {
+                if (Pool* pool = find<Pool>()) {
+                    return pool;
+                }
+                pools_.reserve(pools_.size() + 1);  // No leak if this throws after new
+                Pool* pool = backing_ ? new Pool(*backing_) : new Pool();
+                pools_.push_back({ &pool_key<Pool>, pool, [](void* p) noexcept { delete static_cast<Pool*>(p); } });
+                return pool;
+            }
+
+            size_t fallback_count() const noexcept { return fallbacks_; }
+            void count_fallback() noexcept { ++fallbacks_; }
+
+        private:
+            struct Entry {
+                const void* key;
+                void* pool;
+                void (*destroy)(void*) noexcept;
+            };
+
+            std::vector<Entry> pools_;
+            std::optional<BackingOptions> backing_;
+            size_t fallbacks_{ 0 };
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Standard allocator that draws container nodes from MemoryPools
+     *
+     * Node-based containers (std::unordered_map, std::map, std::list) call
+     * operator new for every element. With PoolAllocator each node comes off
+     * a pre-allocated MemoryPool instead: an O(1) free-list pop, no malloc
+     * locks or size-class lookup, and nodes packed together in one block.
+     *
+     * Routing:
+     * - allocate(1) (every node) -> pool for that node's size/alignment
+     * - allocate(n > 1) (bucket arrays, vector growth) -> std::allocator
+     * - pool exhausted -> std::allocator, counted in fallback_count()
+     * deallocate() checks MemoryPool::owns(), so mixed nodes go back to
+     * wherever they came from.
+     *
+     * Copies and rebinds share the same pools and compare equal; allocators
+     * constructed separately do not. The pools live until the last copy
+     * (normally the container) is destroyed.
+     *
+     * Thread Safety: NOT thread-safe (like MemoryPool). One allocator, and
+     * the containers using it, per thread.
+     *
+     * @tparam T Value type
+     * @tparam PoolSize Nodes per pool (one pool per distinct node size)
+     *
+     * Example usage:
+     * @code
+     * using OrderAlloc = PoolAllocator<std::pair<const uint64_t, OrderInfo>, 1 << 20>;
+     * std::unordered_map<uint64_t, OrderInfo, std::hash<uint64_t>,
+     *                    std::equal_to<>, OrderAlloc> orders;
+     * orders.reserve(1 << 20);  // Bucket array: one std::allocator call
+     *
+     * orders.emplace(id, info);  // Node from the pool
+     * orders.erase(id);          // Node back to the pool
+     *
+     * // Huge-page, pre-faulted pools
+     * OrderAlloc alloc(BackingOptions{ HugePages::TRANSPARENT, true, false });
+     * std::unordered_map<uint64_t, OrderInfo, std::hash<uint64_t>,
+     *                    std::equal_to<>, OrderAlloc> book_orders(alloc);
+     * @endcode
+     */
+    template<typename T, size_t PoolSize = 65536>
+    class PoolAllocator {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        // Explicit: the non-type PoolSize parameter defeats the default rebind
+        template<typename U>
+        struct rebind {
+            using other = PoolAllocator<U, PoolSize>;
+        };
+
+        /// Fresh, empty set of pools on the heap
+        PoolAllocator() : pools_(std::make_shared<detail::PoolSet<PoolSize>>()) {}
+
+        /// Fresh set of pools whose slots live in mapped regions (see MappedRegion)
+        explicit PoolAllocator(BackingOptions backing)
+            : pools_(std::make_shared<detail::PoolSet<PoolSize>>(backing)) {}
+
+        PoolAllocator(const PoolAllocator&) noexcept = default;
+        PoolAllocator& operator=(const PoolAllocator&) noexcept = default;
+
+        /// Rebind copy: shares the pools
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U, PoolSize>& other) noexcept : pools_(other.pools_) {}
+
+        /**
+         * @brief Allocate storage for n objects (not constructed)
+         * @throws std::bad_alloc if the std::allocator fallback fails
+         *
+         * Time complexity: O(1) for n == 1 once the pool exists
+         */
+        [[nodiscard]] T* allocate(size_t n) {
+            if (n == 1) [[likely]] {
+                if (!pool_) [[unlikely]] {
+                    pool_ = pools_->template get<Pool>();
+                }
+                if (Block* block = pool_->allocate()) [[likely]] {
+                    return reinterpret_cast<T*>(block);
+                }
+                pools_->count_fallback();
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        /**
+         * @brief Return storage from allocate(n)
+         *
+         * Time complexity: O(1)
+         */
+        void deallocate(T* pointer, size_t n) noexcept {
+            if (n == 1 && !pool_) [[unlikely]] {
+                pool_ = pools_->template find<Pool>();  // Equal copy did the allocating
+            }
+            if (n == 1 && pool_ != nullptr && pool_->owns(pointer)) [[likely]] {
+                pool_->deallocate(reinterpret_cast<Block*>(pointer));
+                return;
+            }
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        /// Nodes for this value type still available in the pool
+        [[nodiscard]] size_t available() const noexcept {
+            return pool_ ? pool_->available() : PoolSize;
+        }
+
+        /// Single-object allocations that missed an exhausted pool
+        [[nodiscard]] size_t fallback_count() const noexcept {
+            return pools_->fallback_count();
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U, PoolSize>& other) const noexcept {
+            return pools_ == other.pools_;
+        }
+
+    private:
+        template<typename, size_t> friend class PoolAllocator;
+
+        using Block = detail::NodeBlock<std::max(sizeof(T), sizeof(void*)), std::max(alignof(T), alignof(void*))>;
+        using Pool = MemoryPool<Block, PoolSize>;
+
+        std::shared_ptr<detail::PoolSet<PoolSize>> pools_;
+
+        // This value type's pool, looked up on first allocate() and cached
+        Pool* pool_{ nullptr };
+    };
+
+} // namespace hft::memory
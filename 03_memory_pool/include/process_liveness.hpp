@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+
+#include <signal.h>
+
+namespace hft::memory {
+
+    /**
+     * @brief True if process `pid` exists (pid <= 0 names no process: false)
+     *
+     * For shared-memory segments that record their owner's pid: a creator
+     * uses it to tell a segment still in use from one left behind by a
+     * crashed owner, a peer to notice the other side died. One kill(pid, 0)
+     * syscall - keep it off the hot path.
+     *
+     * Pids are reused, so "alive" may be a different process that got the
+     * same pid; the answer errs towards alive, never towards reclaiming a
+     * live segment.
+     */
+    inline bool process_alive(int32_t pid) noexcept {
+        // Signal 0 checks existence/permission without delivering anything
+        return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+    }
+
+} // namespace hft::memory
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace hft::memory {
+
+    /**
+     * @brief How a SegmentedMemoryPool obtains new chunks
+     */
+    enum class GrowthMode {
+        BACKGROUND,  // A provisioner thread keeps one pre-faulted spare chunk ready
+        ON_DEMAND,   // Allocate (and page-fault) the chunk inside allocate()
+    };
+
+    /**
+     * @brief Growable memory pool built from fixed-size chunks
+     *
+     * Same intrusive free list as MemoryPool, but when the free list runs dry
+     * the pool appends another chunk of ChunkSize slots instead of returning
+     * nullptr. Chunks are never moved or released while the pool lives, so
+     * pointers handed out stay valid through growth.
+     *
+     * Keeping growth off the hot path:
+     * - Chunks are carved lazily with a bump pointer, so adopting a new chunk
+     *   is O(1) - no pass to thread ChunkSize slots onto the free list.
+     * - In BACKGROUND mode a provisioner thread allocates the next chunk and
+     *   touches every page of it before it is needed. Growing is then one
+     *   atomic exchange plus a wake-up; the provisioner prepares the next
+     *   spare on its own time and otherwise sleeps (no polling).
+     * - If allocation outruns the provisioner (spare not ready yet), the
+     *   chunk is allocated inline and counted in sync_growths().
+     *
+     * Performance characteristics:
+     * - Allocation/deallocation: same as MemoryPool, plus one predictable
+     *   branch for the bump pointer
+     * - Growth: O(1) with a ready spare, plus one futex wake (a syscall,
+     *   once per ChunkSize allocations - never on the non-growing path)
+     * - Memory is only returned when the pool is destroyed
+     *
+     * Thread Safety: NOT thread-safe (like MemoryPool). The provisioner thread
+     * only touches the spare chunk it hands over.
+     *
+     * @tparam T Type of objects to pool
+     * @tparam ChunkSize Objects per chunk
+     *
+     * Example usage:
+     * @code
+     * SegmentedMemoryPool<Order, 4096> order_pool;   // Starts with one chunk
+     *
+     * Order* order = order_pool.allocate(order_id, price, quantity);
+     * // ... millions more: the pool grows, `order` never moves
+     * order_pool.deallocate(order);
+     * @endcode
+     */
+    template<typename T, size_t ChunkSize>
+    class SegmentedMemoryPool {
+    public:
+        static_assert(ChunkSize > 0, "Chunk size must be greater than zero");
+
+        static constexpr size_t UNLIMITED = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Construct the pool with one chunk ready for allocation
+         *
+         * @param mode Whether a background thread pre-faults spare chunks
+         * @param max_chunks Upper bound on chunks; allocate() returns nullptr
+         *        once all are in use
+         *
+         * @throws std::bad_alloc if the first chunk cannot be allocated
+         */
+        explicit SegmentedMemoryPool(GrowthMode mode = GrowthMode::BACKGROUND,
+                                     size_t max_chunks = UNLIMITED)
+            : mode_(mode), max_chunks_(max_chunks == 0 ? 1 : max_chunks) {
+            Chunk* first = make_chunk();
+            if (first == nullptr) {
+                throw std::bad_alloc();
+            }
+            adopt(first);
+
+            if (mode_ == GrowthMode::BACKGROUND) {
+                provisioner_ = std::thread([this] { provision_loop(); });
+            }
+        }
+
+        /**
+         * @brief Destructor - stops the provisioner and frees every chunk
+         *
+         * WARNING: Does NOT call destructors on allocated objects!
+         */
+        ~SegmentedMemoryPool() noexcept {
+            if (provisioner_.joinable()) {
+                stop_.store(true, std::memory_order_relaxed);
+                wake_provisioner();
+                provisioner_.join();
+            }
+            free_chunk(spare_.load(std::memory_order_acquire));
+            while (chunks_ != nullptr) {
+                Chunk* next = chunks_->next;
+                free_chunk(chunks_);
+                chunks_ = next;
+            }
+        }
+
+        SegmentedMemoryPool(const SegmentedMemoryPool&) = delete;
+        SegmentedMemoryPool& operator=(const SegmentedMemoryPool&) = delete;
+        SegmentedMemoryPool(SegmentedMemoryPool&&) = delete;
+        SegmentedMemoryPool& operator=(SegmentedMemoryPool&&) = delete;
+
+        /**
+         * @brief Allocate and construct an object, growing the pool if needed
+         *
+         * @return Pointer to constructed object, or nullptr if max_chunks are
+         *         all in use or a new chunk could not be allocated
+         */
+        template<typename... Args>
+        [[nodiscard]] T* allocate(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+            Slot* slot = free_list_;
+            if (slot != nullptr) {
+                free_list_ = slot->next;
+            } else {
+                // Never-used tail of the newest chunk, then a new chunk
+                if (bump_ == bump_end_ && !grow()) {
+                    return nullptr;
+                }
+                slot = bump_++;
+            }
+            ++allocated_;
+            return new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Destruct and return an object to the pool
+         *
+         * WARNING: Passing an object not allocated from this pool is undefined behavior!
+         */
+        void deallocate(T* object) noexcept {
+            if (object == nullptr) {
+                return;
+            }
+            object->~T();
+
+            Slot* slot = reinterpret_cast<Slot*>(object);
+            slot->next = free_list_;
+            free_list_ = slot;
+            --allocated_;
+        }
+
+        /// Objects currently allocated
+        [[nodiscard]] size_t size() const noexcept {
+            return allocated_;
+        }
+
+        /// Slots in chunks owned by the pool (excludes the spare)
+        [[nodiscard]] size_t capacity() const noexcept {
+            return chunk_count() * ChunkSize;
+        }
+
+        /// Objects that can be allocated without growing
+        [[nodiscard]] size_t available() const noexcept {
+            return capacity() - allocated_;
+        }
+
+        [[nodiscard]] size_t chunk_count() const noexcept {
+            return chunk_count_.load(std::memory_order_relaxed);
+        }
+
+        /// Growths that had to allocate inline because no spare was ready
+        [[nodiscard]] size_t sync_growths() const noexcept {
+            return sync_growths_;
+        }
+
+    private:
+        union Slot {
+            T object;
+            Slot* next;
+
+            Slot() {}
+            ~Slot() {}
+        };
+
+        struct Chunk {
+            Chunk* next;                                // Older chunk
+            Slot* slots() noexcept {
+                return reinterpret_cast<Slot*>(reinterpret_cast<std::byte*>(this) + SLOTS_OFFSET);
+            }
+        };
+
+        static constexpr size_t CHUNK_ALIGN = alignof(Slot) > 64 ? alignof(Slot) : 64;
+        static constexpr size_t SLOTS_OFFSET = (sizeof(Chunk) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+        static constexpr size_t CHUNK_BYTES = SLOTS_OFFSET + sizeof(Slot) * ChunkSize;
+        static constexpr size_t PAGE_SIZE = 4096;
+
+        static_assert(alignof(Slot) >= alignof(T), "Alignment mismatch");
+
+        /// Allocate a chunk and touch every page so it is backed by real memory
+        static Chunk* make_chunk() noexcept {
+            auto* memory = static_cast<std::byte*>(
+                ::operator new(CHUNK_BYTES, std::align_val_t{CHUNK_ALIGN}, std::nothrow));
+            if (memory == nullptr) {
+                return nullptr;
+            }
+            for (size_t offset = 0; offset < CHUNK_BYTES; offset += PAGE_SIZE) {
+                static_cast<volatile std::byte*>(memory)[offset] = std::byte{0};
+            }
+            static_cast<volatile std::byte*>(memory)[CHUNK_BYTES - 1] = std::byte{0};
+            return ::new (memory) Chunk{ nullptr };
+        }
+
+        static void free_chunk(Chunk* chunk) noexcept {
+            if (chunk != nullptr) {
+                ::operator delete(chunk, std::align_val_t{CHUNK_ALIGN});
+            }
+        }
+
+        void adopt(Chunk* chunk) noexcept {
+            chunk->next = chunks_;
+            chunks_ = chunk;
+            bump_ = chunk->slots();
+            bump_end_ = bump_ + ChunkSize;
+            chunk_count_.store(chunk_count() + 1, std::memory_order_relaxed);
+        }
+
+        /// Cold path: make a new chunk current
+        [[gnu::noinline]] bool grow() noexcept {
+            if (chunk_count() >= max_chunks_) {
+                return false;
+            }
+
+            Chunk* chunk = nullptr;
+            if (mode_ == GrowthMode::BACKGROUND) {
+                chunk = spare_.exchange(nullptr, std::memory_order_acquire);
+                // Also after an inline growth: a failed make_chunk() retries now
+                wake_provisioner();
+            }
+            if (chunk == nullptr) {
+                chunk = make_chunk();
+                if (chunk == nullptr) {
+                    return false;
+                }
+                ++sync_growths_;
+            }
+            adopt(chunk);
+            return true;
+        }
+
+        /// Owner side: bump the wake counter and wake a sleeping provisioner
+        void wake_provisioner() noexcept {
+            wake_.fetch_add(1, std::memory_order_release);
+            wake_.notify_one();
+        }
+
+        /**
+         * @brief Provisioner thread: keep exactly one spare chunk ready
+         *
+         * Sleeps on wake_ (a futex on Linux) while the spare is present or
+         * the pool cannot grow; grow() and the destructor bump wake_. The
+         * wake-up costs the owner one syscall per growth, which is already
+         * the cold path - allocate() without growth never touches wake_.
+         * Runs at SCHED_IDLE on Linux.
+         */
+        void provision_loop() noexcept {
+#if defined(__linux__)
+            // Only run when the core is otherwise idle: pre-faulting must not
+            // preempt the trading thread that shares (or later migrates to) it
+            sched_param param{};
+            pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+            for (;;) {
+                // Read before checking, so a wake between check and wait is not lost
+                const uint32_t seen = wake_.load(std::memory_order_acquire);
+                if (stop_.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                // The spare counts toward max_chunks once adopted
+                if (spare_.load(std::memory_order_relaxed) == nullptr &&
+                    chunk_count() < max_chunks_) {
+                    if (Chunk* chunk = make_chunk()) {
+                        spare_.store(chunk, std::memory_order_release);
+                    }
+                }
+                wake_.wait(seen, std::memory_order_acquire);
+            }
+        }
+
+        // Hot path state (owner thread)
+        Slot* free_list_{ nullptr };
+        Slot* bump_{ nullptr };
+        Slot* bump_end_{ nullptr };
+        size_t allocated_{ 0 };
+
+        // Growth state
+        Chunk* chunks_{ nullptr };          // Newest first
+        size_t sync_growths_{ 0 };
+        const GrowthMode mode_;
+        const size_t max_chunks_;
+        std::atomic<size_t> chunk_count_{ 0 };  // Read by the provisioner
+
+        // Hand-off with the provisioner, on its own cache line
+        alignas(64) std::atomic<Chunk*> spare_{ nullptr };
+        std::atomic<uint32_t> wake_{ 0 };       // Bumped when the provisioner has work
+        std::atomic<bool> stop_{ false };
+        std::thread provisioner_;
+    };
+
+} // namespace hft::memory
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "backing_memory.hpp"
+
+namespace hft::memory {
+
+    /**
+     * @brief Counters for one size class of a SlabAllocator
+     */
+    struct SizeClassStats {
+        size_t slot_size{ 0 };    // Bytes per slot
+        size_t capacity{ 0 };     // Slots reserved for the class
+        size_t in_use{ 0 };       // Currently allocated
+        size_t peak_in_use{ 0 };  // High-water mark of in_use
+        size_t allocations{ 0 };  // Successful allocate() calls
+        size_t failures{ 0 };     // allocate() calls that found the class exhausted
+    };
+
+    /**
+     * @brief Variable-size allocator built from power-of-two size classes
+     *
+     * MemoryPool serves one T. The pipeline allocates many differently sized
+     * objects (decoded messages, order records, book nodes, outbound OUCH
+     * buffers), so the slab keeps one MemoryPool-style intrusive free list
+     * per size class: 16, 32, 64 ... 2048 bytes. A request is rounded up to
+     * its class, which is a bit_width() away - no search, no headers, no
+     * coalescing.
+     *
+     * Layout: one contiguous block (heap or MappedRegion) split into a
+     * segment per class, each 64-byte aligned. Slots are carved from a
+     * segment with a bump pointer the first time they are needed, so
+     * construction does not touch every slot; freed slots go on the class's
+     * free list and are reused first.
+     *
+     * Alignment: a slot is aligned to min(slot size, 64), which covers
+     * alignof(T) for any T that fits its class (up to cache-line alignment).
+     *
+     * Performance characteristics:
+     * - Allocation/deallocation: O(1) - class index, free-list pop/push and
+     *   a few counter updates
+     * - Internal fragmentation: under 50% per object (power-of-two rounding)
+     * - No external fragmentation: a class never lends slots to another
+     *
+     * Thread Safety: NOT thread-safe (like MemoryPool). Use one slab per thread.
+     *
+     * Example usage:
+     * @code
+     * //                     16   32      64      128    256   512  1024 2048
+     * SlabAllocator slab({ 1024, 65536, 131072, 16384, 4096, 256, 64, 16 });
+     *
+     * auto* order = slab.create<OrderRecord>(id, price, shares);  // 64-byte class
+     * void* ouch  = slab.allocate(49);                              // 64-byte class
+     *
+     * slab.destroy(order);
+     * slab.deallocate(ouch);
+     *
+     * const auto& s = slab.stats(SlabAllocator::size_class(64));
+     * // s.peak_in_use, s.failures ... for capacity planning
+     * @endcode
+     */
+    class SlabAllocator {
+    public:
+        static constexpr size_t MIN_CLASS_SIZE = 16;
+        static constexpr size_t NUM_SIZE_CLASSES = 8;
+        static constexpr size_t MAX_CLASS_SIZE = MIN_CLASS_SIZE << (NUM_SIZE_CLASSES - 1);  // 2048
+        static constexpr size_t SEGMENT_ALIGNMENT = 64;
+
+        using ClassCapacities = std::array<size_t, NUM_SIZE_CLASSES>;
+
+        /**
+         * @brief Index of the size class serving `bytes` (bytes <= MAX_CLASS_SIZE)
+         */
+        static constexpr size_t size_class(size_t bytes) noexcept {
+            return bytes <= MIN_CLASS_SIZE
+                ? 0
+                : static_cast<size_t>(std::bit_width(bytes - 1)) - static_cast<size_t>(std::bit_width(MIN_CLASS_SIZE - 1));
+        }
+
+        /**
+         * @brief Slot size of class `index`
+         */
+        static constexpr size_t class_size(size_t index) noexcept {
+            return MIN_CLASS_SIZE << index;
+        }
+
+        /**
+         * @brief Reserve slots_per_class[i] slots of class_size(i) on the heap
+         * @throws std::bad_alloc if the block cannot be allocated
+         */
+        explicit SlabAllocator(const ClassCapacities& slots_per_class) {
+            const size_t bytes = layout_bytes(slots_per_class);
+            storage_ = static_cast<std::byte*>(
+                ::operator new(bytes, std::align_val_t{ SEGMENT_ALIGNMENT }));
+            init_classes(slots_per_class);
+        }
+
+        /**
+         * @brief Same, with the block in a MappedRegion (huge pages, pre-faulted, locked)
+         */
+        SlabAllocator(const ClassCapacities& slots_per_class, BackingOptions backing)
+            : region_(layout_bytes(slots_per_class), backing) {
+            storage_ = static_cast<std::byte*>(region_.data());
+            init_classes(slots_per_class);
+        }
+
+        /**
+         * @brief Frees the block. Does NOT run destructors of live objects.
+         */
+        ~SlabAllocator() noexcept {
+            if (region_.data() == nullptr) {
+                ::operator delete(storage_, std::align_val_t{ SEGMENT_ALIGNMENT });
+            }
+        }
+
+        // Stationary, like MemoryPool
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+        SlabAllocator(SlabAllocator&&) = delete;
+        SlabAllocator& operator=(SlabAllocator&&) = delete;
+
+        /**
+         * @brief Allocate raw storage for `bytes` bytes
+         * @return Slot of size class_size(size_class(bytes)), or nullptr if
+         *         bytes > MAX_CLASS_SIZE or the class is exhausted
+         *
+         * Time complexity: O(1)
+         */
+        [[nodiscard]] void* allocate(size_t bytes) noexcept {
+            if (bytes > MAX_CLASS_SIZE) [[unlikely]] {
+                ++oversize_requests_;
+                return nullptr;
+            }
+            SizeClass& cls = classes_[size_class(bytes)];
+
+            void* slot;
+            if (cls.free_list != nullptr) {
+                slot = cls.free_list;
+                cls.free_list = cls.free_list->next;
+            } else if (cls.bump != cls.limit) {
+                slot = cls.bump;
+                cls.bump += cls.stats.slot_size;
+            } else {
+                ++cls.stats.failures;
+                return nullptr;
+            }
+
+            ++cls.stats.allocations;
+            if (++cls.stats.in_use > cls.stats.peak_in_use) {
+                cls.stats.peak_in_use = cls.stats.in_use;
+            }
+            return slot;
+        }
+
+        /**
+         * @brief Return storage from allocate(); the class is found from the address
+         *
+         * Time complexity: O(1) - at most NUM_SIZE_CLASSES address compares
+         *
+         * WARNING: Passing a pointer not allocated from this slab is undefined behavior!
+         */
+        void deallocate(void* pointer) noexcept {
+            if (pointer == nullptr) {
+                return;
+            }
+            const auto* bytes = static_cast<const std::byte*>(pointer);
+            size_t index = 0;
+            while (bytes >= classes_[index].end) {
+                ++index;
+            }
+            release(classes_[index], pointer);
+        }
+
+        /**
+         * @brief Return storage when the caller knows the requested size (no address compares)
+         * @param bytes The size passed to allocate()
+         */
+        void deallocate(void* pointer, size_t bytes) noexcept {
+            if (pointer != nullptr) {
+                release(classes_[size_class(bytes)], pointer);
+            }
+        }
+
+        /**
+         * @brief Allocate and construct a T in its size class
+         * @return Constructed object, or nullptr if the class is exhausted
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] T* create(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+            static_assert(sizeof(T) <= MAX_CLASS_SIZE, "Type too large for the largest size class");
+            static_assert(alignof(T) <= SEGMENT_ALIGNMENT, "Type alignment exceeds slot alignment");
+            void* memory = allocate(sizeof(T));
+            if (memory == nullptr) {
+                return nullptr;
+            }
+            if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+                return new (memory) T(std::forward<Args>(args)...);
+            } else {
+                try {
+                    return new (memory) T(std::forward<Args>(args)...);
+                } catch (...) {
+                    deallocate(memory, sizeof(T));
+                    throw;
+                }
+            }
+        }
+
+        /**
+         * @brief Destruct and return an object from create()
+         */
+        template<typename T>
+        void destroy(T* object) noexcept {
+            if (object != nullptr) {
+                object->~T();
+                deallocate(object, sizeof(T));
+            }
+        }
+
+        /**
+         * @brief Check whether `pointer` lies in this slab's block
+         */
+        [[nodiscard]] bool owns(const void* pointer) const noexcept {
+            const auto* bytes = static_cast<const std::byte*>(pointer);
+            return bytes >= storage_ && bytes < classes_[NUM_SIZE_CLASSES - 1].end;
+        }
+
+        /**
+         * @brief Counters for size class `index` (see size_class())
+         */
+        [[nodiscard]] const SizeClassStats& stats(size_t index) const noexcept {
+            return classes_[index].stats;
+        }
+
+        /**
+         * @brief Requests larger than MAX_CLASS_SIZE (always refused)
+         */
+        [[nodiscard]] size_t oversize_requests() const noexcept {
+            return oversize_requests_;
+        }
+
+        /**
+         * @brief NUMA node the block is bound to
+         * @return ANY_NUMA_NODE for heap-backed slabs or if binding was unavailable
+         */
+        [[nodiscard]] int numa_node() const noexcept {
+            return region_.numa_node();
+        }
+
+    private:
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        struct SizeClass {
+            std::byte* bump{ nullptr };   // Next never-used slot
+            std::byte* limit{ nullptr };  // One past the last slot
+            std::byte* end{ nullptr };    // Start of the next segment (limit + padding)
+            FreeSlot* free_list{ nullptr };
+            SizeClassStats stats;
+        };
+
+        static constexpr size_t segment_bytes(size_t index, size_t slots) noexcept {
+            const size_t bytes = slots * class_size(index);
+            return (bytes + SEGMENT_ALIGNMENT - 1) & ~(SEGMENT_ALIGNMENT - 1);
+        }
+
+        static size_t layout_bytes(const ClassCapacities& slots_per_class) noexcept {
+            size_t total = 0;
+            for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+                total += segment_bytes(i, slots_per_class[i]);
+            }
+            return total == 0 ? SEGMENT_ALIGNMENT : total;
+        }
+
+        /// Split the block into one segment per class (constructors only)
+        void init_classes(const ClassCapacities& slots_per_class) noexcept {
+            std::byte* cursor = storage_;
+            for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+                SizeClass& cls = classes_[i];
+                cls.bump = cursor;
+                cls.limit = cursor + slots_per_class[i] * class_size(i);
+                cursor += segment_bytes(i, slots_per_class[i]);
+                cls.end = cursor;
+                cls.stats.slot_size = class_size(i);
+                cls.stats.capacity = slots_per_class[i];
+            }
+        }
+
+        static void release(SizeClass& cls, void* pointer) noexcept {
+            auto* slot = static_cast<FreeSlot*>(pointer);
+            slot->next = cls.free_list;
+            cls.free_list = slot;
+            --cls.stats.in_use;
+        }
+
+        static_assert(std::has_single_bit(MIN_CLASS_SIZE) && MIN_CLASS_SIZE >= sizeof(FreeSlot),
+            "Smallest class must be a power of two that fits a free-list link");
+
+        std::array<SizeClass, NUM_SIZE_CLASSES> classes_{};
+
+        // One block for every segment
+        std::byte* storage_{ nullptr };
+
+        // Owns storage_ when constructed with BackingOptions (empty otherwise)
+        MappedRegion region_;
+
+        size_t oversize_requests_{ 0 };
+    };
+
+} // namespace hft::memory
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace hft::memory {
+
+    /// Maximum threads that can hold a registry index at once
+    inline constexpr size_t MAX_REGISTERED_THREADS = 256;
+    inline constexpr size_t NO_THREAD_INDEX = MAX_REGISTERED_THREADS;
+
+    /**
+     * @brief Process-wide registry handing each live thread a small index
+     *
+     * Structures that need per-thread state shared across threads (pool
+     * caches, hazard words, reclamation records) keep a flat array indexed
+     * by it, instead of one thread_local per instance: a thread's entry sits
+     * in its own cache line and a scanner can walk every entry.
+     *
+     * One index per thread, shared by every user. It is returned when the
+     * thread exits and may be reused by a later thread, which then inherits
+     * whatever the previous owner left in each array (users must leave
+     * entries valid for that - e.g. cached pool slots, pending retire lists).
+     */
+    class ThreadRegistry {
+    public:
+        static ThreadRegistry& instance() noexcept {
+            static ThreadRegistry registry;
+            return registry;
+        }
+
+        /// A free index, or NO_THREAD_INDEX if all are taken
+        size_t try_acquire() noexcept {
+            for (size_t i = 0; i < MAX_REGISTERED_THREADS; ++i) {
+                bool expected = false;
+                if (!used_[i].load(std::memory_order_relaxed) &&
+                    used_[i].compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    size_t high = high_water_.load(std::memory_order_relaxed);
+                    while (high < i + 1 &&
+                           !high_water_.compare_exchange_weak(high, i + 1, std::memory_order_seq_cst)) {
+                    }
+                    return i;
+                }
+            }
+            return NO_THREAD_INDEX;
+        }
+
+        void release(size_t index) noexcept {
+            if (index != NO_THREAD_INDEX) {
+                // Release: the next owner sees everything this thread left behind
+                used_[index].store(false, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief One past the highest index ever handed out: scanners may stop here
+         *
+         * seq_cst on both sides: a thread raises it before any seq_cst
+         * announcement it makes with its index, so a scanner that must see
+         * the announcement also sees the raised bound.
+         */
+        [[nodiscard]] size_t high_water() const noexcept {
+            return high_water_.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        std::array<std::atomic<bool>, MAX_REGISTERED_THREADS> used_{};
+        std::atomic<size_t> high_water_{ 0 };
+    };
+
+    namespace detail {
+
+        struct ThreadIndexHolder {
+            size_t index = ThreadRegistry::instance().try_acquire();
+            ~ThreadIndexHolder() { ThreadRegistry::instance().release(index); }
+        };
+
+        inline ThreadIndexHolder& this_thread_index_holder() noexcept {
+            thread_local ThreadIndexHolder holder;
+            return holder;
+        }
+
+    } // namespace detail
+
+    /// This thread's index (NO_THREAD_INDEX if all were taken when it first asked)
+    inline size_t this_thread_index() noexcept {
+        return detail::this_thread_index_holder().index;
+    }
+
+    /**
+     * @brief This thread's index, waiting (yielding) until one is free
+     *
+     * For users with no fallback path. A thread that got NO_THREAD_INDEX
+     * from this_thread_index() earlier picks up the index obtained here.
+     */
+    inline size_t this_thread_index_wait() noexcept {
+        auto& holder = detail::this_thread_index_holder();
+        while (holder.index == NO_THREAD_INDEX) [[unlikely]] {
+            std::this_thread::yield();
+            holder.index = ThreadRegistry::instance().try_acquire();
+        }
+        return holder.index;
+    }
+
+} // namespace hft::memory
@@ -4,7 +4,29 @@
 #include <numeric>
 #include <algorithm>
 #include <iomanip>
+#include <tuple>
+#include <thread>
+#include <mutex>
+#include <barrier>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <random>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include "memory_pool.hpp"
+#include "concurrent_memory_pool.hpp"
+#include "pool_allocator.hpp"
+#include "segmented_memory_pool.hpp"
+#include "slab_allocator.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 using namespace hft::memory;
 using namespace std::chrono;
@@ -201,6 +223,634 @@ void benchmark_latency_distribution() {
     std::cout << "  P99.9:   " << (nd_p999 / pool_p999) << "x faster\n";
 }
 
+// ============================================================================
+// Multi-threaded scaling
+// ============================================================================
+
+constexpr size_t MT_POOL_SIZE = 16'384;               // Multiple of the batch size
+constexpr size_t MT_OPS_PER_THREAD = 1'000'000;        // Alloc+free pairs per thread
+constexpr size_t MT_HELD = 64;                         // Objects each thread keeps live
+constexpr size_t MT_SEGMENT = 512;                     // Cross-thread: objects per hand-off
+constexpr size_t MT_THREAD_COUNTS[] = { 1, 2, 4, 8 };
+
+// glibc malloc: per-thread tcache in front of per-thread arenas, the same
+// two-tier idea as jemalloc/tcmalloc
+struct NewDeleteAllocator {
+    Order* allocate(size_t id) { return new Order(id, 100.0, 100); }
+    void deallocate(Order* order) { delete order; }
+};
+
+// The single-threaded pool made shareable the obvious way
+struct LockedPoolAllocator {
+    std::mutex mutex;
+    MemoryPool<Order, MT_POOL_SIZE> pool;
+
+    Order* allocate(size_t id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pool.allocate(id, 100.0, 100);
+    }
+    void deallocate(Order* order) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pool.deallocate(order);
+    }
+};
+
+struct ConcurrentPoolAllocator {
+    ConcurrentMemoryPool<Order, MT_POOL_SIZE> pool;
+
+    Order* allocate(size_t id) { return pool.allocate(id, 100.0, 100); }
+    void deallocate(Order* order) { pool.deallocate(order); }
+};
+
+Order* checked(Order* order) {
+    if (order == nullptr) {
+        throw std::runtime_error("pool exhausted in multi-threaded benchmark");
+    }
+    return order;
+}
+
+// Each thread allocates and frees its own objects, keeping MT_HELD live
+template<typename Allocator>
+double benchmark_threads_local(Allocator& allocator, size_t num_threads) {
+    std::barrier start_line(static_cast<std::ptrdiff_t>(num_threads + 1));
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            Order* held[MT_HELD];
+            start_line.arrive_and_wait();
+            for (size_t i = 0; i < MT_HELD; ++i) {
+                held[i] = checked(allocator.allocate(t));
+            }
+            for (size_t i = 0; i < MT_OPS_PER_THREAD; ++i) {
+                Order*& slot = held[i % MT_HELD];
+                allocator.deallocate(slot);
+                slot = checked(allocator.allocate(i));
+            }
+            for (Order* order : held) {
+                allocator.deallocate(order);
+            }
+        });
+    }
+
+    start_line.arrive_and_wait();
+    auto start = high_resolution_clock::now();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = high_resolution_clock::now();
+    return duration<double>(end - start).count();
+}
+
+// Producer/consumer shape: thread t allocates a segment, thread t+1 frees it
+template<typename Allocator>
+double benchmark_threads_cross(Allocator& allocator, size_t num_threads) {
+    constexpr size_t ROUNDS = MT_OPS_PER_THREAD / MT_SEGMENT;
+    std::vector<Order*> segments(num_threads * MT_SEGMENT);
+    std::barrier phase(static_cast<std::ptrdiff_t>(num_threads));
+    std::barrier start_line(static_cast<std::ptrdiff_t>(num_threads + 1));
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            Order** mine = &segments[t * MT_SEGMENT];
+            Order** next = &segments[((t + 1) % num_threads) * MT_SEGMENT];
+            start_line.arrive_and_wait();
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (size_t i = 0; i < MT_SEGMENT; ++i) {
+                    mine[i] = checked(allocator.allocate(i));
+                }
+                phase.arrive_and_wait();
+                for (size_t i = 0; i < MT_SEGMENT; ++i) {
+                    allocator.deallocate(next[i]);  // Allocated by another thread
+                }
+                phase.arrive_and_wait();
+            }
+        });
+    }
+
+    start_line.arrive_and_wait();
+    auto start = high_resolution_clock::now();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = high_resolution_clock::now();
+    return duration<double>(end - start).count();
+}
+
+// Aggregate Mops/s (one op = one alloc + one free) for a fresh allocator
+template<typename Allocator, typename Benchmark>
+double threaded_mops(Benchmark benchmark, size_t num_threads) {
+    auto allocator = std::make_unique<Allocator>();
+    double seconds = benchmark(*allocator, num_threads);
+    return static_cast<double>(num_threads * MT_OPS_PER_THREAD) / seconds / 1e6;
+}
+
+void benchmark_thread_scaling() {
+    std::cout << "\n=== Test 3: Multi-threaded Scaling ===\n";
+    std::cout << "Ops per thread: " << MT_OPS_PER_THREAD << " alloc+free pairs, pool size "
+              << MT_POOL_SIZE << "\n";
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "WARNING: single hardware thread - threads time-slice one core, so this\n"
+                  << "         measures lock hand-off cost, not parallel speedup.\n";
+    }
+
+    auto print_table = [](const char* title, auto local_or_cross) {
+        std::cout << "\n" << title << " (aggregate Mops/s)\n";
+        std::cout << std::left << std::setw(10) << "Threads"
+                  << std::right << std::setw(14) << "new/delete"
+                  << std::setw(16) << "Mutex+Pool"
+                  << std::setw(16) << "Concurrent" << "\n";
+        std::cout << std::string(56, '-') << "\n";
+        std::cout << std::fixed << std::setprecision(1);
+        for (size_t n : MT_THREAD_COUNTS) {
+            std::cout << std::left << std::setw(10) << n
+                      << std::right << std::setw(14) << local_or_cross(std::type_identity<NewDeleteAllocator>{}, n)
+                      << std::setw(16) << local_or_cross(std::type_identity<LockedPoolAllocator>{}, n)
+                      << std::setw(16) << local_or_cross(std::type_identity<ConcurrentPoolAllocator>{}, n) << "\n";
+        }
+    };
+
+    print_table("Thread-local churn", [](auto tag, size_t n) {
+        using Allocator = typename decltype(tag)::type;
+        return threaded_mops<Allocator>(benchmark_threads_local<Allocator>, n);
+    });
+    print_table("Cross-thread free (t allocates, t+1 frees)", [](auto tag, size_t n) {
+        using Allocator = typename decltype(tag)::type;
+        return threaded_mops<Allocator>(benchmark_threads_cross<Allocator>, n);
+    });
+}
+
+// ============================================================================
+// Growth: allocation latency while open-order count keeps rising
+// ============================================================================
+
+constexpr size_t GROWTH_CHUNK = 4096;
+constexpr size_t GROWTH_OBJECTS = 1'000'000;      // ~244 chunk growths
+constexpr size_t GROWTH_BURST = 1024;             // Orders per packet burst
+
+struct GrowthResult {
+    const char* name;
+    std::vector<double> latencies;
+    size_t sync_growths;
+};
+
+// Allocate GROWTH_OBJECTS without freeing, timing each allocation. Between
+// bursts the thread sleeps briefly, standing in for waiting on the next packet.
+template<typename AllocateFn>
+std::vector<double> time_growth(AllocateFn allocate) {
+    std::vector<double> latencies;
+    latencies.reserve(GROWTH_OBJECTS);
+    for (size_t i = 0; i < GROWTH_OBJECTS; ++i) {
+        if (i % GROWTH_BURST == 0) {
+            std::this_thread::sleep_for(microseconds(1));
+        }
+        auto start = high_resolution_clock::now();
+        Order* order = allocate(i);
+        auto end = high_resolution_clock::now();
+        if (order == nullptr) {
+            throw std::runtime_error("allocation failed in growth benchmark");
+        }
+        latencies.push_back(duration<double, std::nano>(end - start).count());
+    }
+    return latencies;
+}
+
+GrowthResult growth_segmented(const char* name, GrowthMode mode) {
+    SegmentedMemoryPool<Order, GROWTH_CHUNK> pool(mode);
+    auto latencies = time_growth([&](size_t i) { return pool.allocate(i, 100.0, 100); });
+    return { name, std::move(latencies), pool.sync_growths() };
+}
+
+GrowthResult growth_fixed() {
+    // Sized for the worst case up front: the flat line growth should match
+    auto pool = std::make_unique<MemoryPool<Order, GROWTH_OBJECTS>>();
+    auto latencies = time_growth([&](size_t i) { return pool->allocate(i, 100.0, 100); });
+    return { "MemoryPool (presized)", std::move(latencies), 0 };
+}
+
+GrowthResult growth_new_delete() {
+    std::vector<Order*> orders;
+    orders.reserve(GROWTH_OBJECTS);
+    auto latencies = time_growth([&](size_t i) {
+        orders.push_back(new Order(i, 100.0, 100));
+        return orders.back();
+    });
+    for (Order* order : orders) {
+        delete order;
+    }
+    return { "new", std::move(latencies), 0 };
+}
+
+void benchmark_growth() {
+    std::cout << "\n=== Test 4: Allocation Latency Through Growth ===\n";
+    std::cout << "Objects: " << GROWTH_OBJECTS << " (never freed), chunk size " << GROWTH_CHUNK
+              << ", idle gap every " << GROWTH_BURST << " allocations\n";
+
+    std::vector<GrowthResult> results;
+    results.push_back(growth_fixed());
+    results.push_back(growth_segmented("Segmented (on demand)", GrowthMode::ON_DEMAND));
+    results.push_back(growth_segmented("Segmented (background)", GrowthMode::BACKGROUND));
+    results.push_back(growth_new_delete());
+
+    std::cout << "\n" << std::left << std::setw(24) << "Allocator"
+              << std::right << std::setw(8) << "P50"
+              << std::setw(8) << "P99"
+              << std::setw(10) << "P99.99"
+              << std::setw(10) << "Max"
+              << std::setw(14) << "Sync grows" << "   (ns)\n";
+    std::cout << std::string(74, '-') << "\n";
+    std::cout << std::fixed << std::setprecision(0);
+    for (auto& r : results) {
+        std::sort(r.latencies.begin(), r.latencies.end());
+        auto pct = [&](size_t per_10k) { return r.latencies[r.latencies.size() * per_10k / 10'000]; };
+        std::cout << std::left << std::setw(24) << r.name
+                  << std::right << std::setw(8) << pct(5'000)
+                  << std::setw(8) << pct(9'900)
+                  << std::setw(10) << pct(9'999)
+                  << std::setw(10) << r.latencies.back()
+                  << std::setw(14) << r.sync_growths << "\n";
+    }
+}
+
+// ============================================================================
+// Backing memory: huge pages, pre-faulting, mlock
+// ============================================================================
+
+constexpr size_t BACKING_POOL_SIZE = 1 << 20;     // ~40 MB of Orders
+constexpr size_t BACKING_ACCESSES = 10'000'000;
+
+// Counts one perf event for the calling thread; nullopt where the kernel or
+// VM does not expose it (dTLB counters are often missing under virtualisation)
+class PerfCounter {
+public:
+#if defined(__linux__)
+    PerfCounter(uint32_t type, uint64_t config) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    ~PerfCounter() { if (fd_ >= 0) close(fd_); }
+
+    void start() {
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    std::optional<uint64_t> stop() {
+        uint64_t count = 0;
+        if (fd_ < 0) {
+            return std::nullopt;
+        }
+        ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+            return std::nullopt;
+        }
+        return count;
+    }
+
+    static PerfCounter dtlb_misses() {
+        return PerfCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    }
+    static PerfCounter page_faults() {
+        return PerfCounter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+    }
+
+private:
+    int fd_{ -1 };
+#else
+    static PerfCounter dtlb_misses() { return {}; }
+    static PerfCounter page_faults() { return {}; }
+    void start() {}
+    std::optional<uint64_t> stop() { return std::nullopt; }
+#endif
+};
+
+std::string format_count(std::optional<uint64_t> count) {
+    return count ? std::to_string(*count) : std::string("n/a");
+}
+
+struct BackingResult {
+    const char* name;
+    double construct_ms;
+    std::optional<uint64_t> construct_faults;
+    double access_ns;
+    std::optional<uint64_t> access_dtlb_misses;
+};
+
+// Build the pool, fill it, then update orders in random order: every touch
+// lands on a random page of the 40 MB pool
+template<typename MakePool>
+BackingResult benchmark_backing(const char* name, MakePool make_pool) {
+    using Pool = MemoryPool<Order, BACKING_POOL_SIZE>;
+    auto faults = PerfCounter::page_faults();
+    auto dtlb = PerfCounter::dtlb_misses();
+
+    faults.start();
+    auto start = high_resolution_clock::now();
+    std::unique_ptr<Pool> pool = make_pool();
+    auto end = high_resolution_clock::now();
+    auto construct_faults = faults.stop();
+    double construct_ms = duration<double, std::milli>(end - start).count();
+
+    std::vector<Order*> orders;
+    orders.reserve(BACKING_POOL_SIZE);
+    for (size_t i = 0; i < BACKING_POOL_SIZE; ++i) {
+        orders.push_back(pool->allocate(i, 100.0, 100));
+    }
+    std::shuffle(orders.begin(), orders.end(), std::mt19937_64(42));
+
+    dtlb.start();
+    start = high_resolution_clock::now();
+    for (size_t i = 0; i < BACKING_ACCESSES; ++i) {
+        orders[i & (BACKING_POOL_SIZE - 1)]->quantity += 1;
+    }
+    end = high_resolution_clock::now();
+    auto access_dtlb_misses = dtlb.stop();
+
+    for (Order* order : orders) {
+        pool->deallocate(order);
+    }
+    return { name, construct_ms, construct_faults,
+             duration<double, std::nano>(end - start).count() / BACKING_ACCESSES, access_dtlb_misses };
+}
+
+void benchmark_backing_memory() {
+    using Pool = MemoryPool<Order, BACKING_POOL_SIZE>;
+    std::cout << "\n=== Test 5: Backing Memory (huge pages / pre-fault / mlock) ===\n";
+    std::cout << "Pool: " << BACKING_POOL_SIZE << " orders ("
+              << (BACKING_POOL_SIZE * sizeof(Order) >> 20) << " MiB), "
+              << BACKING_ACCESSES << " random-order updates\n";
+
+    std::vector<BackingResult> results;
+    results.push_back(benchmark_backing("Heap (operator new)", [] {
+        return std::make_unique<Pool>();
+    }));
+    results.push_back(benchmark_backing("mmap 4K, on demand", [] {
+        return std::make_unique<Pool>(BackingOptions{ HugePages::NONE, false, false });
+    }));
+    results.push_back(benchmark_backing("mmap 4K, populated", [] {
+        return std::make_unique<Pool>(BackingOptions{ HugePages::NONE, true, false });
+    }));
+    results.push_back(benchmark_backing("THP, populated", [] {
+        return std::make_unique<Pool>(BackingOptions{ HugePages::TRANSPARENT, true, false });
+    }));
+    results.push_back(benchmark_backing("HUGETLB, populated+lock", [] {
+        return std::make_unique<Pool>(BackingOptions{ HugePages::EXPLICIT, true, true });
+    }));
+
+    std::cout << "\n" << std::left << std::setw(26) << "Backing"
+              << std::right << std::setw(14) << "Build (ms)"
+              << std::setw(14) << "Build faults"
+              << std::setw(14) << "Access (ns)"
+              << std::setw(14) << "dTLB misses" << "\n";
+    std::cout << std::string(82, '-') << "\n";
+    for (const auto& r : results) {
+        std::cout << std::left << std::setw(26) << r.name
+                  << std::right << std::fixed << std::setprecision(1) << std::setw(14) << r.construct_ms
+                  << std::setw(14) << format_count(r.construct_faults)
+                  << std::setprecision(2) << std::setw(14) << r.access_ns
+                  << std::setw(14) << format_count(r.access_dtlb_misses) << "\n";
+    }
+    std::cout << "Build includes the free-list pass, which touches every slot.\n"
+              << "HUGETLB falls back to THP without reserved huge pages; lock falls back\n"
+              << "to unlocked over RLIMIT_MEMLOCK.\n";
+}
+
+// Benchmark: Order-index churn (std::unordered_map nodes, default vs pool allocator)
+//
+// Same shape as the trading system's OrderBook::orders_ (order id -> price,
+// shares, side): a steady book of live orders where every step cancels one,
+// adds a new one and updates a third. Bucket array reserved up front, so the
+// only allocations left are the per-order hash nodes.
+constexpr size_t CHURN_LIVE_ORDERS = 100'000;
+constexpr size_t CHURN_STEPS = 1'000'000;
+constexpr size_t CHURN_POOL_SIZE = 1 << 17;  // Node slots per pool (> live orders)
+
+struct IndexedOrder {
+    int64_t price;
+    uint32_t shares;
+    char side;
+};
+
+using OrderEntry = std::pair<const uint64_t, IndexedOrder>;
+using HeapOrderIndex = std::unordered_map<uint64_t, IndexedOrder>;
+using PooledOrderIndex = std::unordered_map<uint64_t, IndexedOrder, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                            PoolAllocator<OrderEntry, CHURN_POOL_SIZE>>;
+
+struct ChurnResult {
+    std::string name;
+    double mean_ns;
+    std::vector<double> latencies;
+    std::optional<size_t> fallbacks;
+};
+
+template<typename Index>
+ChurnResult benchmark_churn(const std::string& name, Index orders) {
+    orders.reserve(CHURN_LIVE_ORDERS);
+    std::vector<uint64_t> live(CHURN_LIVE_ORDERS);
+    for (size_t i = 0; i < CHURN_LIVE_ORDERS; ++i) {
+        live[i] = i + 1;
+        orders.emplace(live[i], IndexedOrder{ static_cast<int64_t>(1'000'000 + i % 500), 100, 'B' });
+    }
+
+    std::mt19937_64 rng(7);
+    uint64_t next_id = CHURN_LIVE_ORDERS + 1;
+    std::vector<double> latencies;
+    latencies.reserve(CHURN_STEPS);
+
+    auto total_start = high_resolution_clock::now();
+    for (size_t step = 0; step < CHURN_STEPS; ++step) {
+        const size_t cancel = rng() % CHURN_LIVE_ORDERS;
+        const uint64_t executed = live[rng() % CHURN_LIVE_ORDERS];
+
+        auto start = high_resolution_clock::now();
+        orders.erase(live[cancel]);
+        orders.emplace(next_id, IndexedOrder{ static_cast<int64_t>(1'000'000 + step % 500), 100, 'S' });
+        if (auto it = orders.find(executed); it != orders.end()) {
+            it->second.shares -= 1;
+        }
+        auto end = high_resolution_clock::now();
+
+        live[cancel] = next_id++;
+        latencies.push_back(duration<double, std::nano>(end - start).count());
+    }
+    auto total_end = high_resolution_clock::now();
+
+    std::optional<size_t> fallbacks;
+    if constexpr (!std::is_same_v<Index, HeapOrderIndex>) {
+        fallbacks = orders.get_allocator().fallback_count();
+    }
+    return { name, duration<double, std::nano>(total_end - total_start).count() / CHURN_STEPS,
+             std::move(latencies), fallbacks };
+}
+
+void benchmark_order_index_churn() {
+    std::cout << "\n=== Test 6: Order-Index Churn (unordered_map nodes) ===\n";
+    std::cout << "Live orders: " << CHURN_LIVE_ORDERS << ", " << CHURN_STEPS
+              << " steps of cancel + add + update\n";
+
+    std::vector<ChurnResult> results;
+    results.push_back(benchmark_churn("std::allocator", HeapOrderIndex{}));
+    results.push_back(benchmark_churn("PoolAllocator (heap)", PooledOrderIndex{}));
+    results.push_back(benchmark_churn("PoolAllocator (THP)", PooledOrderIndex(
+        PoolAllocator<OrderEntry, CHURN_POOL_SIZE>(BackingOptions{ HugePages::TRANSPARENT, true, false }))));
+
+    std::cout << "\n" << std::left << std::setw(24) << "Allocator"
+              << std::right << std::setw(10) << "Mean"
+              << std::setw(8) << "P50"
+              << std::setw(8) << "P99"
+              << std::setw(10) << "P99.99"
+              << std::setw(12) << "Fallbacks" << "   (ns per step)\n";
+    std::cout << std::string(72, '-') << "\n";
+    std::cout << std::fixed << std::setprecision(0);
+    for (auto& r : results) {
+        std::sort(r.latencies.begin(), r.latencies.end());
+        auto pct = [&](size_t per_10k) { return r.latencies[r.latencies.size() * per_10k / 10'000]; };
+        std::cout << std::left << std::setw(24) << r.name
+                  << std::right << std::setw(10) << std::setprecision(1) << r.mean_ns
+                  << std::setprecision(0) << std::setw(8) << pct(5'000)
+                  << std::setw(8) << pct(9'900)
+                  << std::setw(10) << pct(9'999)
+                  << std::setw(12) << (r.fallbacks ? std::to_string(*r.fallbacks) : std::string("-")) << "\n";
+    }
+    std::cout << "Mean is loop wall time / steps, including the per-step clock reads.\n";
+}
+
+// Benchmark: Mixed-size workload (new/delete vs slab size classes)
+//
+// Pipeline-shaped object sizes: decoded ITCH messages (12-50 bytes), order
+// records, book (MBO) nodes, outbound OUCH buffers and the occasional
+// snapshot. A window of live objects is kept; every step frees a random one
+// and allocates the next size in the sequence.
+constexpr size_t MIXED_LIVE_OBJECTS = 16'384;
+constexpr size_t MIXED_STEPS = 2'000'000;
+
+std::vector<uint16_t> make_mixed_sizes(size_t count) {
+    std::mt19937_64 rng(3);
+    std::vector<uint16_t> sizes(count);
+    for (auto& size : sizes) {
+        const auto roll = rng() % 100;
+        if (roll < 40) {
+            size = static_cast<uint16_t>(12 + rng() % 39);   // Decoded message
+        } else if (roll < 70) {
+            size = 40;                                      // Order record
+        } else if (roll < 85) {
+            size = 64;                                      // MBO node
+        } else if (roll < 97) {
+            size = static_cast<uint16_t>(47 + rng() % 50);  // OUCH buffer
+        } else {
+            size = static_cast<uint16_t>(256 + rng() % 769); // Snapshot
+        }
+    }
+    return sizes;
+}
+
+struct MixedResult {
+    std::string name;
+    double mean_ns;
+    std::vector<double> latencies;
+};
+
+template<typename Allocate, typename Deallocate>
+MixedResult benchmark_mixed(const std::string& name, const std::vector<uint16_t>& sizes,
+                            Allocate&& allocate, Deallocate&& deallocate) {
+    struct Live {
+        void* pointer;
+        size_t size;
+    };
+    std::vector<Live> live(MIXED_LIVE_OBJECTS);
+    for (size_t i = 0; i < MIXED_LIVE_OBJECTS; ++i) {
+        live[i] = { allocate(sizes[i]), sizes[i] };
+    }
+
+    std::mt19937_64 rng(5);
+    std::vector<double> latencies;
+    latencies.reserve(MIXED_STEPS);
+
+    auto total_start = high_resolution_clock::now();
+    for (size_t step = 0; step < MIXED_STEPS; ++step) {
+        Live& victim = live[rng() % MIXED_LIVE_OBJECTS];
+        const size_t size = sizes[step];
+
+        auto start = high_resolution_clock::now();
+        deallocate(victim.pointer, victim.size);
+        auto* bytes = static_cast<unsigned char*>(allocate(size));
+        bytes[0] = 1;          // Touch both ends, as a writer would
+        bytes[size - 1] = 1;
+        auto end = high_resolution_clock::now();
+
+        victim = { bytes, size };
+        latencies.push_back(duration<double, std::nano>(end - start).count());
+    }
+    auto total_end = high_resolution_clock::now();
+
+    for (const auto& object : live) {
+        deallocate(object.pointer, object.size);
+    }
+    return { name, duration<double, std::nano>(total_end - total_start).count() / MIXED_STEPS,
+             std::move(latencies) };
+}
+
+void benchmark_mixed_sizes() {
+    std::cout << "\n=== Test 7: Mixed-Size Workload (slab size classes) ===\n";
+    std::cout << "Live objects: " << MIXED_LIVE_OBJECTS << ", " << MIXED_STEPS
+              << " steps of free + allocate (12 B - 1 KiB)\n";
+
+    const auto sizes = make_mixed_sizes(MIXED_STEPS);
+    //                        16     32      64     128    256   512  1024  2048
+    SlabAllocator slab({ 2'048, 8'192, 32'768, 4'096, 1'024, 512, 512, 64 });
+
+    std::vector<MixedResult> results;
+    results.push_back(benchmark_mixed("new/delete", sizes,
+        [](size_t size) { return ::operator new(size); },
+        [](void* pointer, size_t size) { ::operator delete(pointer, size); }));
+    results.push_back(benchmark_mixed("SlabAllocator", sizes,
+        [&](size_t size) {
+            void* pointer = slab.allocate(size);
+            if (pointer == nullptr) {
+                throw std::runtime_error("slab size class exhausted");
+            }
+            return pointer;
+        },
+        [&](void* pointer, size_t size) { slab.deallocate(pointer, size); }));
+
+    std::cout << "\n" << std::left << std::setw(24) << "Allocator"
+              << std::right << std::setw(10) << "Mean"
+              << std::setw(8) << "P50"
+              << std::setw(8) << "P99"
+              << std::setw(10) << "P99.99" << "   (ns per step)\n";
+    std::cout << std::string(60, '-') << "\n";
+    for (auto& r : results) {
+        std::sort(r.latencies.begin(), r.latencies.end());
+        auto pct = [&](size_t per_10k) { return r.latencies[r.latencies.size() * per_10k / 10'000]; };
+        std::cout << std::left << std::setw(24) << r.name
+                  << std::right << std::fixed << std::setw(10) << std::setprecision(1) << r.mean_ns
+                  << std::setprecision(0) << std::setw(8) << pct(5'000)
+                  << std::setw(8) << pct(9'900)
+                  << std::setw(10) << pct(9'999) << "\n";
+    }
+
+    std::cout << "\nSlab size classes:\n";
+    std::cout << std::right << std::setw(8) << "Slot" << std::setw(10) << "Capacity"
+              << std::setw(10) << "In use" << std::setw(10) << "Peak"
+              << std::setw(14) << "Allocations" << std::setw(10) << "Failures" << "\n";
+    std::cout << std::string(62, '-') << "\n";
+    for (size_t i = 0; i < SlabAllocator::NUM_SIZE_CLASSES; ++i) {
+        const auto& stats = slab.stats(i);
+        std::cout << std::setw(8) << stats.slot_size << std::setw(10) << stats.capacity
+                  << std::setw(10) << stats.in_use << std::setw(10) << stats.peak_in_use
+                  << std::setw(14) << stats.allocations << std::setw(10) << stats.failures << "\n";
+    }
+}
+
 // Main benchmark runner
 void run_benchmark() {
     std::cout << "=== Memory Pool Benchmark (Fair Comparison) ===\n";
@@ -284,6 +934,21 @@ void run_benchmark() {
     
     // Latency distribution
     benchmark_latency_distribution();
+
+    // Thread scaling
+    benchmark_thread_scaling();
+
+    // Growth
+    benchmark_growth();
+
+    // Backing memory
+    benchmark_backing_memory();
+
+    // Container nodes from pools
+    benchmark_order_index_churn();
+
+    // Variable-size objects
+    benchmark_mixed_sizes();
     
     std::cout << "\n=== Summary ===\n";
     std::cout << "Pure allocation speedup:   " << (avg_nd_pure / avg_pool_pure) << "x\n";
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include "shared_ptr.hpp"
+#include "thread_registry.hpp"
+
+namespace hft::smart {
+
+    /**
+     * @brief Atomic slot holding a SharedPtr, for rarely-updated shared data
+     *
+     * Reference data (symbol directory, tick tables, risk limits) is read on
+     * every message and replaced a few times a day. Guarding a
+     * std::shared_ptr with a mutex - or copying it out of
+     * std::atomic<std::shared_ptr> - makes every read a locked
+     * read-modify-write on one cache line that all readers share, so read
+     * cost grows with the number of reader threads.
+     *
+     * Here a reader never touches the reference count:
+     * - read() announces the block it is about to use in its own hazard
+     *   word (one per thread, one cache line each), re-checks the slot and
+     *   returns a Snapshot. Cost: one store and one load, both on lines the
+     *   writer rarely touches.
+     * - store() swaps in the new version, then waits until no hazard word
+     *   still names the old one before dropping the slot's reference.
+     *   Writers pay for reclamation; readers never wait.
+     *
+     * Treat the published object as immutable: build a new version, then
+     * store() it. load() gives a counted SharedPtr for data that must
+     * outlive the current scope (one atomic increment, like a copy).
+     *
+     * Limits:
+     * - The hazard word holds one pointer: while a thread holds a Snapshot,
+     *   its further read()/load() calls on the same slot fall back to taking
+     *   a reference on the block (one contended increment, like a copy).
+     *   Keep hazard snapshots short - a writer waits for them.
+     * - Hazard words are indexed by memory::ThreadRegistry: beyond
+     *   MAX_REGISTERED_THREADS live threads, extra readers take the same
+     *   counted fallback.
+     * - A thread must not store() while holding a Snapshot of the slot: the
+     *   writer would wait for its own reader forever.
+     *
+     * Memory ordering: the hazard store and the re-check load are seq_cst,
+     * as are the writer's exchange and hazard scan - either the writer sees
+     * the hazard, or the reader sees the new pointer and retries.
+     *
+     * @tparam T Type of the published object (typically const)
+     *
+     * Example usage:
+     * @code
+     * AtomicSharedPtr<const TickTable> ticks(make_shared<const TickTable>(load_ticks()));
+     *
+     * // Hot thread, per message
+     * if (auto table = ticks.read()) {
+     *     price = table->round(price);
+     * }
+     *
+     * // Reference-data thread, on update
+     * ticks.store(make_shared<const TickTable>(load_ticks()));
+     * @endcode
+     */
+    template<typename T>
+    class AtomicSharedPtr {
+        using Block = ControlBlock<T>;
+
+    public:
+        /**
+         * @brief Borrowed view of the version current when read() was called
+         *
+         * Keeps that version alive until destroyed, without owning it.
+         * Move-only; must be destroyed on the thread that created it.
+         */
+        class Snapshot {
+        public:
+            Snapshot(Snapshot&& other) noexcept
+                : ptr_(std::exchange(other.ptr_, nullptr))
+                , block_(std::exchange(other.block_, nullptr))
+                , hazard_(std::exchange(other.hazard_, nullptr))
+                , counted_(std::exchange(other.counted_, false)) {}
+
+            Snapshot(const Snapshot&) = delete;
+            Snapshot& operator=(const Snapshot&) = delete;
+            Snapshot& operator=(Snapshot&&) = delete;
+
+            ~Snapshot() noexcept {
+                if (hazard_) {
+                    // Release: our reads of the object happen-before the writer frees it
+                    hazard_->store(nullptr, std::memory_order_release);
+                } else if (counted_ && block_) {
+                    block_->release();
+                }
+            }
+
+            T* get() const noexcept { return ptr_; }
+            T& operator*() const noexcept { return *ptr_; }
+            T* operator->() const noexcept { return ptr_; }
+            explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+        private:
+            friend class AtomicSharedPtr;
+
+            Snapshot(Block* block, std::atomic<Block*>* hazard, bool counted) noexcept
+                : ptr_(block ? block->ptr : nullptr), block_(block), hazard_(hazard), counted_(counted) {}
+
+            T* ptr_;
+            Block* block_;
+            std::atomic<Block*>* hazard_;     // This thread's hazard word, or
+            bool counted_;                    // a reference this Snapshot owns
+        };
+
+        // Constructors
+
+        /**
+         * @brief Empty slot
+         */
+        AtomicSharedPtr() noexcept = default;
+
+        /**
+         * @brief Slot holding `initial`
+         */
+        explicit AtomicSharedPtr(SharedPtr<T> initial) noexcept
+            : current_(std::exchange(initial.control_, nullptr)) {}
+
+        /**
+         * @brief Destructor - drops the slot's reference
+         *
+         * No Snapshot of this slot may still be alive.
+         */
+        ~AtomicSharedPtr() noexcept {
+            if (Block* block = current_.load(std::memory_order_relaxed)) {
+                block->release();
+            }
+        }
+
+        // Stationary: readers hold pointers to the hazard words
+        AtomicSharedPtr(const AtomicSharedPtr&) = delete;
+        AtomicSharedPtr& operator=(const AtomicSharedPtr&) = delete;
+
+        // Readers
+
+        /**
+         * @brief Borrow the current version without touching its reference count
+         *
+         * Time complexity: O(1) - one hazard store and one load (retried only
+         * if a writer publishes in between)
+         */
+        [[nodiscard]] Snapshot read() const noexcept {
+            const size_t slot = memory::this_thread_index();
+            // Only this thread writes its hazard word: non-null means one of
+            // its Snapshots of this slot is still alive, so don't overwrite it
+            if (slot == memory::NO_THREAD_INDEX ||
+                hazards_[slot].block.load(std::memory_order_relaxed) != nullptr) [[unlikely]] {
+                // Fallback: own a reference instead of a hazard. The counter
+                // covers only the load-to-add_ref window, so writers never
+                // wait on the Snapshot itself
+                overflow_readers_.fetch_add(1, std::memory_order_seq_cst);
+                Block* block = current_.load(std::memory_order_seq_cst);
+                if (block) {
+                    block->add_ref();
+                }
+                overflow_readers_.fetch_sub(1, std::memory_order_release);
+                return Snapshot(block, nullptr, true);
+            }
+
+            std::atomic<Block*>& hazard = hazards_[slot].block;
+            return Snapshot(protect(hazard), &hazard, false);
+        }
+
+        /**
+         * @brief Owning copy of the current version (one atomic increment)
+         *
+         * Safe while holding a Snapshot of the same slot (takes the counted
+         * path, like a nested read()).
+         */
+        [[nodiscard]] SharedPtr<T> load() const noexcept {
+            const auto snapshot = read();
+            // The snapshot keeps the block alive (hazard or its own reference),
+            // so the count is > 0
+            if (snapshot.block_) {
+                snapshot.block_->add_ref();
+            }
+            return SharedPtr<T>(snapshot.block_);
+        }
+
+        // Writers
+
+        /**
+         * @brief Publish `desired`; returns once no reader can still see the old version
+         *
+         * The old version's destructor runs here if the slot held the last
+         * reference. Safe to call from several writer threads, but never
+         * while the calling thread holds a Snapshot of this slot (deadlock:
+         * it waits for that Snapshot). Use load() there instead.
+         */
+        void store(SharedPtr<T> desired) noexcept {
+            (void)exchange(std::move(desired));
+        }
+
+        /**
+         * @brief Publish `desired` and return the previous version
+         *
+         * Also waits for the old version's readers, so the caller may drop
+         * the result straight away. Same deadlock rule as store().
+         */
+        SharedPtr<T> exchange(SharedPtr<T> desired) noexcept {
+            Block* old = current_.exchange(std::exchange(desired.control_, nullptr),
+                                           std::memory_order_seq_cst);
+            if (old) {
+                wait_for_readers(old);
+            }
+            return SharedPtr<T>(old);  // Adopts the slot's reference
+        }
+
+    private:
+        struct alignas(64) HazardWord {
+            std::atomic<Block*> block{ nullptr };
+        };
+
+        /// Announce the current block in `hazard` until it is stable
+        Block* protect(std::atomic<Block*>& hazard) const noexcept {
+            Block* block = current_.load(std::memory_order_relaxed);
+            for (;;) {
+                hazard.store(block, std::memory_order_seq_cst);
+                Block* again = current_.load(std::memory_order_seq_cst);
+                if (again == block) {
+                    return block;
+                }
+                block = again;
+            }
+        }
+
+        /// Writer side: wait until no reader still announces `old`
+        void wait_for_readers(Block* old) const noexcept {
+            // Indices past the high-water mark were never handed out
+            const size_t threads = memory::ThreadRegistry::instance().high_water();
+            for (size_t i = 0; i < threads; ++i) {
+                while (hazards_[i].block.load(std::memory_order_seq_cst) == old) {
+                    std::this_thread::yield();
+                }
+            }
+            // Fallback readers between loading current_ and add_ref - a few
+            // instructions each; their Snapshots then hold their own reference
+            while (overflow_readers_.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        alignas(64) std::atomic<Block*> current_{ nullptr };
+
+        // One line per reader thread: read() writes only its own
+        mutable std::array<HazardWord, memory::MAX_REGISTERED_THREADS> hazards_{};
+
+        // Fallback readers still taking their reference
+        alignas(64) mutable std::atomic<size_t> overflow_readers_{ 0 };
+    };
+
+} // namespace hft::smart
@@ -0,0 +1,361 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hft::smart {
+
+    // Reference Count Policies
+
+    /**
+     * @brief Thread-safe count - for objects handed between threads
+     *
+     * Same memory ordering as ControlBlock: relaxed increment, acq_rel
+     * decrement (every owner's writes happen-before the destroy).
+     */
+    struct AtomicRefCount {
+        std::atomic<uint32_t> value{ 0 };
+
+        void increment() noexcept {
+            value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Return true if this was the last reference
+        bool decrement() noexcept {
+            return value.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        uint32_t load() const noexcept {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Plain count - for objects that never leave one thread
+     *
+     * No lock prefix: an add/release pair is two ordinary increments
+     * instead of two locked read-modify-writes.
+     */
+    struct PlainRefCount {
+        uint32_t value{ 0 };
+
+        void increment() noexcept { ++value; }
+        bool decrement() noexcept { return --value == 0; }
+        uint32_t load() const noexcept { return value; }
+    };
+
+    /**
+     * @brief Base class that puts the reference count inside the object
+     *
+     * SharedPtr keeps its counts in a separately allocated ControlBlock:
+     * two allocations per object and a second cache line touched on every
+     * copy. Deriving from RefCounted puts the count next to the data, so
+     * IntrusivePtr is one pointer and an object is one allocation.
+     *
+     * When the last reference goes away, Derived::intrusive_destroy(p) is
+     * called. The default deletes the object; a derived class can declare
+     * its own public static intrusive_destroy() to recycle it instead (see
+     * PoolRefCounted).
+     *
+     * For polymorphic hierarchies derive the root from RefCounted<Root> and
+     * give it a virtual destructor.
+     *
+     * @tparam Derived The class deriving from RefCounted (CRTP)
+     * @tparam Count AtomicRefCount (default) or PlainRefCount
+     *
+     * Example usage:
+     * @code
+     * struct BookSnapshot : RefCounted<BookSnapshot> {
+     *     std::array<Level, 10> bids, asks;
+     * };
+     *
+     * IntrusivePtr<const BookSnapshot> snap = make_intrusive<BookSnapshot>();
+     * auto copy = snap;   // One atomic increment on the snapshot's own line
+     * @endcode
+     */
+    template<typename Derived, typename Count = AtomicRefCount>
+    class RefCounted {
+    public:
+        /**
+         * @brief Number of IntrusivePtrs currently referencing this object
+         */
+        uint32_t ref_count() const noexcept {
+            return count_.load();
+        }
+
+        /**
+         * @brief Default end of life: delete the object
+         */
+        static void intrusive_destroy(Derived* object) noexcept {
+            delete object;
+        }
+
+    protected:
+        RefCounted() noexcept = default;
+
+        // Copying an object does not copy its owners
+        RefCounted(const RefCounted&) noexcept {}
+        RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+
+        ~RefCounted() = default;
+
+    private:
+        // Found by argument-dependent lookup from IntrusivePtr
+        friend void intrusive_add_ref(const RefCounted* object) noexcept {
+            object->count_.increment();
+        }
+
+        friend void intrusive_release(const RefCounted* object) noexcept {
+            if (object->count_.decrement()) {
+                Derived::intrusive_destroy(static_cast<Derived*>(const_cast<RefCounted*>(object)));
+            }
+        }
+
+        mutable Count count_;
+    };
+
+    template<typename T>
+    class IntrusivePtr;
+
+    template<typename T, typename Pool, typename... Args>
+    IntrusivePtr<T> make_intrusive_pooled(Pool& pool, Args&&... args);
+
+    /**
+     * @brief RefCounted object that returns itself to its pool on last release
+     *
+     * Pool is any pool with `T* allocate(args...)` (nullptr when exhausted)
+     * and `void deallocate(T*)` that runs the destructor - e.g.
+     * hft::memory::MemoryPool<Derived, N>. Create objects with
+     * make_intrusive_pooled(); the object remembers its pool, so whichever
+     * thread drops the last reference recycles it.
+     *
+     * The pool itself must be safe to deallocate into from that thread
+     * (MemoryPool is single-threaded; use PlainRefCount with it, or a
+     * thread-safe pool with AtomicRefCount).
+     *
+     * Example usage:
+     * @code
+     * struct Quote : PoolRefCounted<Quote, MemoryPool<Quote, 4096>, PlainRefCount> {
+     *     Quote(int64_t b, int64_t a) : bid(b), ask(a) {}
+     *     int64_t bid, ask;
+     * };
+     *
+     * MemoryPool<Quote, 4096> pool;
+     * {
+     *     auto quote = make_intrusive_pooled<Quote>(pool, 100, 101);
+     *     auto copy = quote;
+     * } // Last reference gone: destructor runs, slot back in the pool
+     * @endcode
+     */
+    template<typename Derived, typename Pool, typename Count = AtomicRefCount>
+    class PoolRefCounted : public RefCounted<Derived, Count> {
+    public:
+        /**
+         * @brief End of life: hand the object back to the pool it came from
+         */
+        static void intrusive_destroy(Derived* object) noexcept {
+            PoolRefCounted* base = object;
+            base->pool_->deallocate(object);
+        }
+
+    protected:
+        PoolRefCounted() noexcept = default;
+        PoolRefCounted(const PoolRefCounted&) noexcept : RefCounted<Derived, Count>() {}
+        PoolRefCounted& operator=(const PoolRefCounted&) noexcept { return *this; }
+        ~PoolRefCounted() = default;
+
+    private:
+        template<typename T, typename P, typename... Args>
+        friend IntrusivePtr<T> make_intrusive_pooled(P& pool, Args&&... args);
+
+        Pool* pool_{ nullptr };
+    };
+
+    /**
+     * @brief Shared ownership pointer for objects that carry their own count
+     *
+     * Works with any T for which `intrusive_add_ref(const T*)` and
+     * `intrusive_release(const T*)` are found by argument-dependent lookup;
+     * RefCounted provides both.
+     *
+     * Compared to SharedPtr:
+     * - sizeof(IntrusivePtr) == sizeof(T*)
+     * - One allocation per object (no control block)
+     * - Copy touches the object's cache line only, which the reader is
+     *   about to touch anyway
+     * - A raw T* can be turned back into an owner (the count is in the
+     *   object), e.g. after passing it through a ring buffer
+     * - No weak references
+     *
+     * Thread safety follows the count: AtomicRefCount objects may be
+     * shared across threads (each IntrusivePtr instance still belongs to
+     * one thread), PlainRefCount objects must stay on one thread.
+     *
+     * @tparam T Type of managed object
+     */
+    template<typename T>
+    class IntrusivePtr {
+    public:
+        using element_type = T;
+
+        // Constructors
+
+        /**
+         * @brief Default constructor - empty pointer
+         */
+        constexpr IntrusivePtr() noexcept : ptr_(nullptr) {}
+
+        /**
+         * @brief nullptr constructor
+         */
+        constexpr IntrusivePtr(std::nullptr_t) noexcept : ptr_(nullptr) {}
+
+        /**
+         * @brief Become an owner of `ptr`
+         *
+         * @param ptr Object to reference (can be nullptr)
+         * @param add_ref false to adopt a reference already counted, e.g.
+         *        one given up earlier with detach()
+         */
+        explicit IntrusivePtr(T* ptr, bool add_ref = true) noexcept : ptr_(ptr) {
+            if (ptr_ && add_ref) {
+                intrusive_add_ref(ptr_);
+            }
+        }
+
+        /**
+         * @brief Copy constructor - one more owner
+         */
+        IntrusivePtr(const IntrusivePtr& other) noexcept : IntrusivePtr(other.ptr_) {}
+
+        /**
+         * @brief Copy from related type (Derived -> Base, T -> const T)
+         */
+        template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        IntrusivePtr(const IntrusivePtr<U>& other) noexcept : IntrusivePtr(other.get()) {}
+
+        /**
+         * @brief Move constructor - no count change
+         */
+        IntrusivePtr(IntrusivePtr&& other) noexcept : ptr_(other.ptr_) {
+            other.ptr_ = nullptr;
+        }
+
+        /**
+         * @brief Move from related type
+         */
+        template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        IntrusivePtr(IntrusivePtr<U>&& other) noexcept : ptr_(other.detach()) {}
+
+        /**
+         * @brief Destructor - drop this owner
+         */
+        ~IntrusivePtr() noexcept {
+            if (ptr_) {
+                intrusive_release(ptr_);
+            }
+        }
+
+        // Assignment Operators
+
+        IntrusivePtr& operator=(const IntrusivePtr& other) noexcept {
+            IntrusivePtr(other).swap(*this);
+            return *this;
+        }
+
+        IntrusivePtr& operator=(IntrusivePtr&& other) noexcept {
+            IntrusivePtr(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        IntrusivePtr& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        // Observers
+
+        T* get() const noexcept { return ptr_; }
+        T& operator*() const noexcept { return *ptr_; }
+        T* operator->() const noexcept { return ptr_; }
+        explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+        /**
+         * @brief Number of owners (requires T to derive from RefCounted)
+         */
+        size_t use_count() const noexcept {
+            return ptr_ ? ptr_->ref_count() : 0;
+        }
+
+        // Modifiers
+
+        /**
+         * @brief Drop ownership, or switch to `ptr`
+         */
+        void reset(T* ptr = nullptr) noexcept {
+            IntrusivePtr(ptr).swap(*this);
+        }
+
+        /**
+         * @brief Give up ownership WITHOUT decrementing the count
+         *
+         * The reference now travels with the raw pointer (e.g. through a
+         * lock-free queue); adopt it on the other side with
+         * IntrusivePtr(ptr, false).
+         */
+        [[nodiscard]] T* detach() noexcept {
+            T* ptr = ptr_;
+            ptr_ = nullptr;
+            return ptr;
+        }
+
+        void swap(IntrusivePtr& other) noexcept {
+            std::swap(ptr_, other.ptr_);
+        }
+
+    private:
+        T* ptr_;
+    };
+
+    // Helper Functions
+
+    /**
+     * @brief Create an IntrusivePtr (like make_shared, one allocation)
+     */
+    template<typename T, typename... Args>
+    IntrusivePtr<T> make_intrusive(Args&&... args) {
+        return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Create an IntrusivePtr to an object from `pool` (see PoolRefCounted)
+     *
+     * @throws std::bad_alloc if the pool is exhausted (like make_pooled)
+     */
+    template<typename T, typename Pool, typename... Args>
+    IntrusivePtr<T> make_intrusive_pooled(Pool& pool, Args&&... args) {
+        T* object = pool.allocate(std::forward<Args>(args)...);
+        if (!object) {
+            throw std::bad_alloc();
+        }
+        object->pool_ = &pool;  // Friend of PoolRefCounted
+        return IntrusivePtr<T>(object);
+    }
+
+    /**
+     * @brief Comparison operators
+     */
+    template<typename T, typename U>
+    bool operator==(const IntrusivePtr<T>& lhs, const IntrusivePtr<U>& rhs) noexcept {
+        return lhs.get() == rhs.get();
+    }
+
+    template<typename T>
+    bool operator==(const IntrusivePtr<T>& lhs, std::nullptr_t) noexcept {
+        return lhs.get() == nullptr;
+    }
+
+} // namespace hft::smart
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <new>
 #include <utility>
 #include <type_traits>
 
@@ -12,21 +13,40 @@ namespace hft::smart {
      * Shared by all shared_ptr instances pointing to the same object.
      * Contains:
      * - Reference count (how many shared_ptrs own the object)
-     * - Weak count (how many weak_ptrs reference it)
+     * - Weak count (how many weak_ptrs reference it, +1 while any
+     *   shared_ptr owns the object)
      * - The actual object pointer
+     * - How to destroy the object and how to free the block
+     *
+     * Two lifetimes: the object dies when ref_count reaches 0, the block
+     * when weak_count reaches 0. The shared owners hold one weak reference
+     * between them, so the block cannot be freed while the object's
+     * destructor is still running (e.g. a node whose destructor drops the
+     * last weak_ptr to itself).
+     *
+     * The block either points at a separately allocated object
+     * (SharedPtr(T*)) or sits in the same allocation as the object
+     * (make_shared). In the second case destroying the object only runs
+     * its destructor; the memory goes when the last weak_ptr does.
      *
      * Thread-safe: Uses atomic operations for reference counting
      */
     template<typename T>
     struct ControlBlock {
+        using Disposer = void (*)(void* block) noexcept;
+
         T* ptr;                          // Pointer to managed object
         std::atomic<size_t> ref_count;   // Number of shared_ptr owners
-        std::atomic<size_t> weak_count;  // Number of weak_ptr references
+        std::atomic<size_t> weak_count;  // Number of weak_ptr references + 1 for the owners
+        Disposer destroy_object;         // Called when ref_count drops to 0
+        Disposer free_block;             // Called when weak_count drops to 0
 
-        ControlBlock(T* p)
+        ControlBlock(T* p, Disposer object_disposer, Disposer block_disposer) noexcept
             : ptr(p)
             , ref_count(1)    // Start with 1 owner
-            , weak_count(0)   // No weak_ptrs yet
+            , weak_count(1)   // Held by the owners as a group
+            , destroy_object(object_disposer)
+            , free_block(block_disposer)
         {
         }
 
@@ -35,20 +55,34 @@ namespace hft::smart {
             ref_count.fetch_add(1, std::memory_order_relaxed);
         }
 
-        // Remove a shared owner, return true if last owner
-        bool release() noexcept {
+        // Add a shared owner unless the object is already gone (weak_ptr::lock)
+        bool try_add_ref() noexcept {
+            size_t count = ref_count.load(std::memory_order_relaxed);
+            while (count != 0) {
+                if (ref_count.compare_exchange_weak(count, count + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Remove a shared owner; destroys the object (and maybe the block) if last
+        void release() noexcept {
             // Decrement and check if we were the last owner
             if (ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-                // We were the last owner - delete the object
-                delete ptr;
-                ptr = nullptr;
-
-                // If no weak_ptrs exist, delete the control block too
-                if (weak_count.load(std::memory_order_acquire) == 0) {
-                    return true;  // Caller should delete control block
+                // We were the last owner - destroy the object, then drop
+                // the owners' weak reference (frees the block if no weak_ptrs)
+                destroy_object(this);
+
+                // No weak_ptrs left (and none can appear without an owner):
+                // skip the second atomic read-modify-write
+                if (weak_count.load(std::memory_order_acquire) == 1) {
+                    free_block(this);
+                    return;
                 }
+                release_weak();
             }
-            return false;
         }
 
         // Add a weak reference
@@ -56,15 +90,11 @@ namespace hft::smart {
             weak_count.fetch_add(1, std::memory_order_relaxed);
         }
 
-        // Remove a weak reference, return true if last weak ref
-        bool release_weak() noexcept {
+        // Remove a weak reference; frees the block if it was the last
+        void release_weak() noexcept {
             if (weak_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-                // Last weak reference and object already deleted
-                if (ref_count.load(std::memory_order_acquire) == 0) {
-                    return true;  // Caller should delete control block
-                }
+                free_block(this);
             }
-            return false;
         }
 
         size_t use_count() const noexcept {
@@ -72,6 +102,38 @@ namespace hft::smart {
         }
     };
 
+    namespace detail {
+
+        /// Control block for an object allocated on its own (SharedPtr(T*))
+        template<typename T>
+        ControlBlock<T>* make_separate_block(T* ptr) {
+            using Block = ControlBlock<T>;
+            return new Block(ptr,
+                [](void* block) noexcept { delete static_cast<Block*>(block)->ptr; },
+                [](void* block) noexcept { delete static_cast<Block*>(block); });
+        }
+
+        /**
+         * @brief Control block and object in one allocation (make_shared)
+         *
+         * The header comes first, so the block's address is the allocation's
+         * address; the object follows in suitably aligned raw storage.
+         */
+        template<typename T>
+        struct InlineControlBlock {
+            ControlBlock<T> header;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            InlineControlBlock() noexcept
+                : header(nullptr,
+                    [](void* block) noexcept { static_cast<ControlBlock<T>*>(block)->ptr->~T(); },
+                    [](void* block) noexcept { delete reinterpret_cast<InlineControlBlock*>(block); })
+            {
+            }
+        };
+
+    } // namespace detail
+
     // Forward declaration for weak_ptr
     template<typename T>
     class WeakPtr;
@@ -113,12 +175,15 @@ namespace hft::smart {
          *
          * @param ptr Pointer to manage (can be nullptr)
          */
-        explicit SharedPtr(T* ptr) {
+        explicit SharedPtr(T* ptr) : control_(nullptr) {
             if (ptr) {
-                control_ = new ControlBlock<T>(ptr);
-            }
-            else {
-                control_ = nullptr;
+                try {
+                    control_ = detail::make_separate_block(ptr);
+                }
+                catch (...) {
+                    delete ptr;  // Like std::shared_ptr: never leak the object
+                    throw;
+                }
             }
         }
 
@@ -172,9 +237,7 @@ namespace hft::smart {
          */
         ~SharedPtr() noexcept {
             if (control_) {
-                if (control_->release()) {
-                    delete control_;
-                }
+                control_->release();
             }
         }
 
@@ -187,9 +250,7 @@ namespace hft::smart {
             if (this != &other) {
                 // Release our current object
                 if (control_) {
-                    if (control_->release()) {
-                        delete control_;
-                    }
+                    control_->release();
                 }
 
                 // Share other's object
@@ -208,9 +269,7 @@ namespace hft::smart {
             if (this != &other) {
                 // Release our current object
                 if (control_) {
-                    if (control_->release()) {
-                        delete control_;
-                    }
+                    control_->release();
                 }
 
                 // Take other's object
@@ -306,12 +365,15 @@ namespace hft::smart {
         template<typename U>
         friend class SharedPtr;
 
-        // Private constructor for weak_ptr promotion
-        explicit SharedPtr(ControlBlock<T>* ctrl) : control_(ctrl) {
-            if (control_) {
-                control_->add_ref();
-            }
-        }
+        // Adopt a reference already counted (weak_ptr::lock, make_shared)
+        explicit SharedPtr(ControlBlock<T>* ctrl) noexcept : control_(ctrl) {}
+
+        template<typename U, typename... Args>
+        friend SharedPtr<U> make_shared(Args&&... args);
+
+        // Moves control blocks in and out of its atomic slot
+        template<typename U>
+        friend class AtomicSharedPtr;
     };
 
     // Helper Functions
@@ -322,10 +384,12 @@ namespace hft::smart {
      * More efficient than SharedPtr<T>(new T(...)) because:
      * - Single allocation (object + control block together)
      * - Exception-safe
-     * - Better cache locality
+     * - Better cache locality: get() reads the object pointer from the
+     *   block, and the object is right behind it
      *
-     * Note: Our simplified version still uses two allocations
-     *       Real std::make_shared uses one allocation
+     * Trade-off: the object's memory is only returned when the last
+     * weak_ptr goes away (its destructor still runs with the last
+     * shared_ptr). Avoid for large objects observed by long-lived weak_ptrs.
      *
      * @tparam T Type to construct
      * @tparam Args Constructor argument types
@@ -334,7 +398,16 @@ namespace hft::smart {
      */
     template<typename T, typename... Args>
     SharedPtr<T> make_shared(Args&&... args) {
-        return SharedPtr<T>(new T(std::forward<Args>(args)...));
+        using Block = detail::InlineControlBlock<T>;
+        auto* block = new Block();
+        try {
+            block->header.ptr = ::new (static_cast<void*>(block->storage)) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            delete block;
+            throw;
+        }
+        return SharedPtr<T>(&block->header);
     }
 
     /**
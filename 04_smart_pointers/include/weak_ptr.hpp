@@ -83,9 +83,7 @@ namespace hft::smart {
          */
         ~WeakPtr() noexcept {
             if (control_) {
-                if (control_->release_weak()) {
-                    delete control_;
-                }
+                control_->release_weak();
             }
         }
 
@@ -97,9 +95,7 @@ namespace hft::smart {
         WeakPtr& operator=(const WeakPtr& other) noexcept {
             if (this != &other) {
                 if (control_) {
-                    if (control_->release_weak()) {
-                        delete control_;
-                    }
+                    control_->release_weak();
                 }
 
                 control_ = other.control_;
@@ -116,9 +112,7 @@ namespace hft::smart {
         WeakPtr& operator=(WeakPtr&& other) noexcept {
             if (this != &other) {
                 if (control_) {
-                    if (control_->release_weak()) {
-                        delete control_;
-                    }
+                    control_->release_weak();
                 }
 
                 control_ = other.control_;
@@ -132,9 +126,7 @@ namespace hft::smart {
          */
         WeakPtr& operator=(const SharedPtr<T>& shared) noexcept {
             if (control_) {
-                if (control_->release_weak()) {
-                    delete control_;
-                }
+                control_->release_weak();
             }
 
             control_ = shared.control_;
@@ -175,26 +167,13 @@ namespace hft::smart {
          * @return shared_ptr owning the object, or empty if expired
          */
         SharedPtr<T> lock() const noexcept {
-            // Check if object still exists
-            if (!control_ || control_->ref_count.load(std::memory_order_acquire) == 0) {
-                return SharedPtr<T>();  // Object expired, return empty
-            }
-
-            // Try to increment ref_count
-            // Need to check again inside because another thread might delete between checks
-            size_t old_count = control_->ref_count.load(std::memory_order_relaxed);
-            while (old_count != 0) {
-                if (control_->ref_count.compare_exchange_weak(
-                    old_count, old_count + 1,
-                    std::memory_order_acquire,
-                    std::memory_order_relaxed)) {
-                    // Successfully incremented! Object is safe
-                    return SharedPtr<T>(control_);
-                }
-                // CAS failed, try again with updated old_count
+            // Increment ref_count only if it is not already 0: another
+            // thread may release the last owner between a check and an add
+            if (control_ && control_->try_add_ref()) {
+                return SharedPtr<T>(control_);  // Adopts the reference just taken
             }
 
-            // Object expired during our attempt
+            // Object expired (the block itself is still alive: we hold a weak ref)
             return SharedPtr<T>();
         }
 
@@ -205,9 +184,7 @@ namespace hft::smart {
          */
         void reset() noexcept {
             if (control_) {
-                if (control_->release_weak()) {
-                    delete control_;
-                }
+                control_->release_weak();
                 control_ = nullptr;
             }
         }
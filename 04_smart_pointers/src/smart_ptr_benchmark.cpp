@@ -0,0 +1,357 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "atomic_shared_ptr.hpp"
+#include "shared_ptr.hpp"
+#include "weak_ptr.hpp"
+
+// Allocation Counting
+//
+// Global operator new/delete replaced for this executable only, so each
+// test can report exactly how many heap allocations it caused. The
+// counters are plain integers: the multi-threaded test allocates from one
+// thread at a time.
+
+namespace {
+    size_t g_allocations = 0;
+    size_t g_deallocations = 0;
+}
+
+void* operator new(size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    if (p) {
+        ++g_deallocations;
+        std::free(p);
+    }
+}
+
+void operator delete(void* p, size_t) noexcept {
+    ::operator delete(p);
+}
+
+// Test Classes
+
+// Market-data snapshot: one cache line of payload
+struct Quote {
+    uint64_t sequence;
+    int64_t bid_price;
+    int64_t ask_price;
+    uint32_t bid_size;
+    uint32_t ask_size;
+    char symbol[8];
+
+    explicit Quote(uint64_t seq)
+        : sequence(seq), bid_price(1'000'000), ask_price(1'000'100), bid_size(100), ask_size(200), symbol{} {}
+};
+
+constexpr size_t NUM_OBJECTS = 1'000'000;
+constexpr size_t NUM_RUNS = 5;
+
+// Keeps benchmark loops from being optimized away
+volatile uint64_t g_sink = 0;
+
+using namespace std::chrono;
+
+// Benchmark configurations: how each variant creates a pointer
+struct RawNew {
+    static constexpr const char* name = "SharedPtr(new T)";
+    static auto create(uint64_t seq) { return hft::smart::SharedPtr<Quote>(new Quote(seq)); }
+};
+
+struct MakeShared {
+    static constexpr const char* name = "hft make_shared";
+    static auto create(uint64_t seq) { return hft::smart::make_shared<Quote>(seq); }
+};
+
+struct StdMakeShared {
+    static constexpr const char* name = "std::make_shared";
+    static auto create(uint64_t seq) { return std::make_shared<Quote>(seq); }
+};
+
+// Benchmark 1: Heap allocations per object
+template<typename Variant>
+double allocations_per_object() {
+    std::vector<decltype(Variant::create(0))> owners;
+    owners.reserve(NUM_OBJECTS);
+    const size_t before = g_allocations;
+    for (size_t i = 0; i < NUM_OBJECTS; ++i) {
+        owners.push_back(Variant::create(i));
+    }
+    return static_cast<double>(g_allocations - before) / NUM_OBJECTS;
+}
+
+// Benchmark 2: Create + destroy latency (ns per object), best of NUM_RUNS
+template<typename Variant>
+double create_destroy_ns() {
+    double best = 1e30;
+    for (size_t run = 0; run < NUM_RUNS; ++run) {
+        uint64_t checksum = 0;
+        auto start = high_resolution_clock::now();
+        for (size_t i = 0; i < NUM_OBJECTS; ++i) {
+            auto ptr = Variant::create(i);
+            checksum += ptr->sequence;
+        }
+        auto end = high_resolution_clock::now();
+        g_sink = checksum;
+        best = std::min(best, duration<double, std::nano>(end - start).count() / NUM_OBJECTS);
+    }
+    return best;
+}
+
+// Benchmark 3: Random access through a live population (ns per access)
+//
+// Objects are created in arrival order and read in random order, as a
+// strategy would look up snapshots by symbol. SharedPtr::get() first reads
+// the control block, so a separately allocated object costs a second miss.
+template<typename Variant>
+double random_access_ns() {
+    std::vector<decltype(Variant::create(0))> owners;
+    owners.reserve(NUM_OBJECTS);
+    // Unrelated allocations in between, as in a running process
+    std::vector<std::unique_ptr<char[]>> noise;
+    noise.reserve(NUM_OBJECTS);
+    for (size_t i = 0; i < NUM_OBJECTS; ++i) {
+        owners.push_back(Variant::create(i));
+        noise.emplace_back(new char[48]);
+    }
+
+    std::vector<uint32_t> order(NUM_OBJECTS);
+    std::iota(order.begin(), order.end(), 0u);
+    std::shuffle(order.begin(), order.end(), std::mt19937(7));
+
+    int64_t sum = 0;
+    auto start = high_resolution_clock::now();
+    for (uint32_t index : order) {
+        sum += owners[index]->bid_price;
+    }
+    auto end = high_resolution_clock::now();
+    g_sink = static_cast<uint64_t>(sum);
+    return duration<double, std::nano>(end - start).count() / NUM_OBJECTS;
+}
+
+template<typename Variant>
+void print_row() {
+    std::cout << std::left << std::setw(20) << Variant::name
+              << std::right << std::setw(14) << std::setprecision(2) << allocations_per_object<Variant>()
+              << std::setw(16) << std::setprecision(1) << create_destroy_ns<Variant>()
+              << std::setw(16) << random_access_ns<Variant>() << "\n";
+}
+
+// Test 1: make_shared vs two allocations
+void benchmark_make_shared() {
+    std::cout << "\n=== Test 1: make_shared vs SharedPtr(new T) ===\n";
+    std::cout << "Objects: " << NUM_OBJECTS << " x " << sizeof(Quote) << "-byte Quote\n\n";
+
+    std::cout << std::left << std::setw(20) << "Variant"
+              << std::right << std::setw(14) << "Allocs/obj"
+              << std::setw(16) << "Create+free ns"
+              << std::setw(16) << "Random read ns" << "\n";
+    std::cout << std::string(66, '-') << "\n";
+    std::cout << std::fixed;
+    print_row<RawNew>();
+    print_row<MakeShared>();
+    print_row<StdMakeShared>();
+}
+
+// Test 2: Weak references keep the storage, not the object
+void demo_weak_lifetime() {
+    std::cout << "\n=== Test 2: WeakPtr and Co-allocated Storage ===\n";
+
+    struct Tracked {
+        bool* alive;
+        explicit Tracked(bool* flag) : alive(flag) { *alive = true; }
+        ~Tracked() { *alive = false; }
+    };
+
+    bool alive = false;
+    const size_t live_before = g_allocations - g_deallocations;
+
+    hft::smart::WeakPtr<Tracked> weak;
+    {
+        auto shared = hft::smart::make_shared<Tracked>(&alive);
+        weak = shared;
+        std::cout << "Owned:          object alive=" << alive
+                  << ", live allocations +" << (g_allocations - g_deallocations - live_before) << "\n";
+    }
+    std::cout << "Last owner gone: object alive=" << alive
+              << ", live allocations +" << (g_allocations - g_deallocations - live_before)
+              << ", expired=" << weak.expired() << ", lock()=" << static_cast<bool>(weak.lock()) << "\n";
+    weak.reset();
+    std::cout << "Last weak gone:  live allocations +" << (g_allocations - g_deallocations - live_before) << "\n";
+    std::cout << "Destructor runs with the last SharedPtr; the block is freed with the last WeakPtr.\n";
+}
+
+// Reference data read on every message, replaced now and then
+struct TickTable {
+    uint64_t version;
+    std::array<int64_t, 16> tick_sizes;
+
+    explicit TickTable(uint64_t v) : version(v), tick_sizes{} {
+        tick_sizes.fill(static_cast<int64_t>(v));
+    }
+};
+
+constexpr size_t READS_PER_THREAD = 2'000'000;
+constexpr auto PUBLISH_INTERVAL = microseconds(500);
+
+// Benchmark configurations: how readers get at the current TickTable
+struct MutexStdShared {
+    static constexpr const char* name = "mutex + std::shared_ptr";
+    std::mutex mutex;
+    std::shared_ptr<const TickTable> current = std::make_shared<const TickTable>(0);
+
+    int64_t read(size_t i) {
+        std::shared_ptr<const TickTable> table;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            table = current;
+        }
+        return table->tick_sizes[i & 15];
+    }
+
+    void publish(uint64_t version) {
+        auto next = std::make_shared<const TickTable>(version);
+        std::lock_guard<std::mutex> lock(mutex);
+        current.swap(next);  // Old version freed outside the lock
+    }
+};
+
+struct SlotLoad {
+    static constexpr const char* name = "AtomicSharedPtr::load";
+    hft::smart::AtomicSharedPtr<const TickTable> slot{ hft::smart::make_shared<const TickTable>(0) };
+
+    int64_t read(size_t i) {
+        return slot.load()->tick_sizes[i & 15];
+    }
+
+    void publish(uint64_t version) {
+        slot.store(hft::smart::make_shared<const TickTable>(version));
+    }
+};
+
+struct SlotRead {
+    static constexpr const char* name = "AtomicSharedPtr::read";
+    hft::smart::AtomicSharedPtr<const TickTable> slot{ hft::smart::make_shared<const TickTable>(0) };
+
+    int64_t read(size_t i) {
+        return slot.read()->tick_sizes[i & 15];
+    }
+
+    void publish(uint64_t version) {
+        slot.store(hft::smart::make_shared<const TickTable>(version));
+    }
+};
+
+// N reader threads do READS_PER_THREAD reads each while one writer
+// publishes a new version every PUBLISH_INTERVAL. Returns ns per read
+// (wall time / total reads) and the number of versions published.
+template<typename Variant>
+std::pair<double, uint64_t> run_readers(size_t num_readers) {
+    Variant variant;
+    std::atomic<bool> start{ false };
+    std::atomic<size_t> readers_done{ 0 };
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < num_readers; ++r) {
+        readers.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            int64_t sum = 0;
+            for (size_t i = 0; i < READS_PER_THREAD; ++i) {
+                sum += variant.read(i);
+            }
+            g_sink = static_cast<uint64_t>(sum);
+            readers_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    // Started last: from here on only the writer allocates
+    uint64_t versions = 0;
+    std::thread writer([&] {
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        auto next = steady_clock::now() + PUBLISH_INTERVAL;
+        while (readers_done.load(std::memory_order_acquire) != num_readers) {
+            if (steady_clock::now() >= next) {
+                variant.publish(++versions);
+                next += PUBLISH_INTERVAL;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    auto begin = steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    auto end = steady_clock::now();
+    writer.join();
+
+    const double ns = duration<double, std::nano>(end - begin).count();
+    return { ns / static_cast<double>(num_readers * READS_PER_THREAD), versions };
+}
+
+template<typename Variant>
+void print_reader_row(size_t num_readers) {
+    auto [ns_per_read, versions] = run_readers<Variant>(num_readers);
+    std::cout << std::left << std::setw(26) << Variant::name
+              << std::right << std::setw(9) << num_readers
+              << std::setw(14) << std::setprecision(1) << ns_per_read
+              << std::setw(12) << versions << "\n";
+}
+
+// Test 3: Read-mostly reference data
+void benchmark_reference_data() {
+    std::cout << "\n=== Test 3: Reference Data Reads During Updates ===\n";
+    std::cout << "Reads/thread: " << READS_PER_THREAD << ", new version every "
+              << PUBLISH_INTERVAL.count() << " us, "
+              << std::thread::hardware_concurrency() << " hardware threads\n\n";
+
+    std::cout << std::left << std::setw(26) << "Variant"
+              << std::right << std::setw(9) << "Readers"
+              << std::setw(14) << "ns/read"
+              << std::setw(12) << "Versions" << "\n";
+    std::cout << std::string(61, '-') << "\n";
+    std::cout << std::fixed;
+    for (size_t readers : { 1, 2, 4 }) {
+        print_reader_row<MutexStdShared>(readers);
+        print_reader_row<SlotLoad>(readers);
+        print_reader_row<SlotRead>(readers);
+    }
+    std::cout << "ns/read is wall time over all reads: with fewer cores than readers it\n"
+              << "shows total cost per read rather than contention.\n";
+}
+
+int main() {
+    std::cout << "=== Smart Pointer Benchmark ===\n";
+
+    benchmark_make_shared();
+    demo_weak_lifetime();
+    benchmark_reference_data();
+
+    return 0;
+}
@@ -1,3 +1,7 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -6,6 +10,10 @@
 #include "unique_ptr.hpp"
 #include "shared_ptr.hpp"
 #include "weak_ptr.hpp"
+#include "intrusive_ptr.hpp"
+
+// Pool that pooled intrusive objects return to (03_memory_pool)
+#include "memory_pool.hpp"
 
 using namespace hft::smart;
 
@@ -181,6 +189,96 @@ void demo_weak_ptr() {
     std::cout << "Both nodes properly destroyed (no leak)!\n";
 }
 
+// intrusive_ptr Examples
+
+struct BookSnapshot : RefCounted<BookSnapshot> {
+    uint64_t sequence;
+    std::array<int64_t, 10> bid_prices{};
+    std::array<int64_t, 10> ask_prices{};
+
+    explicit BookSnapshot(uint64_t seq) : sequence(seq) {}
+};
+
+struct LocalSnapshot : RefCounted<LocalSnapshot, PlainRefCount> {
+    uint64_t sequence;
+    explicit LocalSnapshot(uint64_t seq) : sequence(seq) {}
+};
+
+struct SharedSnapshot {
+    uint64_t sequence;
+    explicit SharedSnapshot(uint64_t seq) : sequence(seq) {}
+};
+
+using QuotePool = hft::memory::MemoryPool<struct PooledQuote, 4>;
+
+struct PooledQuote : PoolRefCounted<PooledQuote, QuotePool, PlainRefCount> {
+    int64_t bid;
+    int64_t ask;
+
+    PooledQuote(int64_t b, int64_t a) : bid(b), ask(a) {}
+    ~PooledQuote() {
+        std::cout << "Quote " << bid << "/" << ask << " returned to pool\n";
+    }
+};
+
+// Copy + destroy through a ring of owners: ns per handoff
+template<typename Ptr>
+double time_copies(const Ptr& source) {
+    constexpr size_t COPIES = 10'000'000;
+    std::vector<Ptr> owners(1024);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < COPIES; ++i) {
+        owners[i & 1023] = source;  // Add a ref, drop the previous one
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / COPIES;
+}
+
+void demo_intrusive_ptr() {
+    std::cout << "\n|------------------------------------------|\n";
+    std::cout << "|      intrusive_ptr Demonstration         |\n";
+    std::cout << "|------------------------------------------|\n";
+
+    std::cout << "\n--- Example 1: Count Inside the Object ---\n";
+    {
+        IntrusivePtr<const BookSnapshot> snapshot = make_intrusive<BookSnapshot>(42);
+        auto reader = snapshot;
+        std::cout << "Snapshot " << reader->sequence << " use_count: " << snapshot.use_count() << "\n";
+
+        // The count travels with the object: a raw pointer can be re-adopted
+        const BookSnapshot* raw = reader.detach();
+        IntrusivePtr<const BookSnapshot> adopted(raw, false);
+        std::cout << "After detach + adopt, use_count: " << snapshot.use_count() << "\n";
+    }
+
+    std::cout << "\n--- Example 2: Return to Pool on Last Release ---\n";
+    {
+        QuotePool pool;
+        {
+            auto quote = make_intrusive_pooled<PooledQuote>(pool, 100, 101);
+            auto copy = quote;
+            std::cout << "Pool available with quote held twice: " << pool.available() << "\n";
+            quote.reset();
+            std::cout << "After first release, available: " << pool.available() << "\n";
+        }
+        std::cout << "After last release, available: " << pool.available() << "\n";
+    }
+
+    std::cout << "\n--- Example 3: Size and Copy Cost ---\n";
+    std::cout << "sizeof(SharedPtr):     " << sizeof(SharedPtr<SharedSnapshot>) << " bytes + "
+              << sizeof(ControlBlock<SharedSnapshot>) << "-byte control block (2nd allocation)\n";
+    std::cout << "sizeof(IntrusivePtr):  " << sizeof(IntrusivePtr<BookSnapshot>) << " bytes, count in object\n";
+
+    std::cout << "Copy + release (ns):\n" << std::fixed << std::setprecision(1);
+    std::cout << "  SharedPtr:                 "
+              << time_copies(make_shared<SharedSnapshot>(1)) << "\n";
+    std::cout << "  IntrusivePtr (atomic):     "
+              << time_copies(make_intrusive<BookSnapshot>(1)) << "\n";
+    std::cout << "  IntrusivePtr (non-atomic): "
+              << time_copies(make_intrusive<LocalSnapshot>(1)) << "\n";
+}
+
 // Comparison
 
 void demo_comparison() {
@@ -206,6 +304,7 @@ int main() {
         demo_unique_ptr();
         demo_shared_ptr();
         demo_weak_ptr();
+        demo_intrusive_ptr();
         demo_comparison();
 
         std::cout << "\n  All Demonstrations Completed Successfully  \n";
@@ -288,6 +288,250 @@ public:
     }
 };
 
+// ============================================================================
+// Example 9: Bounded MPSC Queue (Per-Slot Sequence Numbers)
+// ============================================================================
+
+// Many producers (strategy threads) -> one consumer (order-entry session).
+// Dmitry Vyukov's bounded queue: each slot carries a sequence number that
+// says whose turn it is, so producers never share a lock or a "slot is
+// ready" flag with each other:
+//   sequence == pos           slot free for the producer holding ticket pos
+//   sequence == pos + 1       slot filled, ready for the consumer
+//   sequence == pos + Cap     slot consumed, free for the next lap
+//
+// Producers claim tickets from tail_. push() takes one with fetch_add, so
+// every producer succeeds on its first RMW instead of retrying a CAS that
+// other producers keep winning; it only waits if the queue is full.
+// try_push() must not commit to a ticket it can't use, so it checks the slot
+// first and CASes (fails only when another producer took the ticket).
+// The single consumer owns head_ outright: no RMW on the pop path.
+template<typename T, size_t Capacity>
+class MpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::array<Slot, Capacity> slots_;
+    alignas(64) std::atomic<size_t> tail_{0};  // Shared by producers
+    alignas(64) size_t head_{0};               // Consumer only
+
+public:
+    MpscQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Producer: Push item, returns false if the queue is full
+    bool try_push(const T& item) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & (Capacity - 1)];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Slot free for this ticket: claim it
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.data = item;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // pos reloaded by the failed CAS
+            } else if (diff < 0) {
+                return false;  // Consumer hasn't freed this slot yet: full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);  // Another producer took it
+            }
+        }
+    }
+
+    // Producer: Push item, waiting while the queue is full
+    void push(const T& item) {
+        const size_t pos = tail_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (Capacity - 1)];
+
+        while (slot.sequence.load(std::memory_order_acquire) != pos) {
+            std::this_thread::yield();  // Full: the consumer is a lap behind
+        }
+        slot.data = item;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    // Consumer: Pop item
+    bool try_pop(T& out_item) {
+        Slot& slot = slots_[head_ & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return false;  // Empty, or the producer holding this ticket hasn't written yet
+        }
+
+        out_item = slot.data;
+        // Hand the slot to whichever producer gets ticket head_ + Capacity
+        slot.sequence.store(head_ + Capacity, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // Approximate (producers may be mid-push); consumer thread only
+    size_t size() const {
+        return tail_.load(std::memory_order_relaxed) - head_;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+};
+
+// ============================================================================
+// Example 10: Bounded MPMC Queue (Per-Slot Sequence Numbers)
+// ============================================================================
+
+// Many producers -> many consumers (e.g. a thread pool rebuilding historical
+// books). Same slot protocol as MpscQueue, with consumers now also claiming
+// tickets from a shared head_:
+//   sequence == pos           slot free for the producer holding ticket pos
+//   sequence == pos + 1       slot filled, ready for the consumer holding pos
+//   sequence == pos + Cap     slot consumed, free for the next lap
+//
+// Each slot is padded to a cache line: with several consumers, neighbouring
+// slots are written by different threads at the same time.
+//
+// try_push()/try_pop() never block (CAS on the ticket only once the slot is
+// known to be usable). push()/pop() take a ticket with fetch_add and then
+// wait for their slot - spinning briefly, yielding, then sleeping on the slot's
+// sequence (atomic wait/notify, a futex on Linux). A blocked pop() only
+// returns once an item arrives, so pools shut down by pushing one sentinel
+// per worker.
+template<typename T, size_t Capacity>
+class MpmcQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
+
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    static constexpr int SPIN_LIMIT = 128;
+    static constexpr int YIELD_LIMIT = 16;
+
+    std::array<Slot, Capacity> slots_;
+    alignas(64) std::atomic<size_t> tail_{0};  // Producers
+    alignas(64) std::atomic<size_t> head_{0};  // Consumers
+
+    // Wait until slot.sequence == expected
+    static void wait_for(Slot& slot, size_t expected) {
+        for (int spin = 0; spin < SPIN_LIMIT + YIELD_LIMIT; ++spin) {
+            if (slot.sequence.load(std::memory_order_acquire) == expected) {
+                return;
+            }
+            if (spin >= SPIN_LIMIT) {
+                std::this_thread::yield();  // Let the peer run if it shares our core
+            }
+        }
+        size_t seq;
+        while ((seq = slot.sequence.load(std::memory_order_acquire)) != expected) {
+            slot.sequence.wait(seq, std::memory_order_acquire);
+        }
+    }
+
+    // Several ticket holders (different laps) may sleep on one slot
+    static void publish(Slot& slot, size_t sequence) {
+        slot.sequence.store(sequence, std::memory_order_release);
+        slot.sequence.notify_all();
+    }
+
+public:
+    MpmcQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // Producer: Push item, returns false if the queue is full
+    bool try_push(const T& item) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & (Capacity - 1)];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.data = item;
+                    publish(slot, pos + 1);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer: Pop item, returns false if the queue is empty
+    bool try_pop(T& out_item) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & (Capacity - 1)];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out_item = slot.data;
+                    publish(slot, pos + Capacity);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Producer: Push item, waiting while the queue is full
+    void push(const T& item) {
+        const size_t pos = tail_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (Capacity - 1)];
+        wait_for(slot, pos);
+        slot.data = item;
+        publish(slot, pos + 1);
+    }
+
+    // Consumer: Pop item, waiting until one is available
+    T pop() {
+        const size_t pos = head_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (Capacity - 1)];
+        wait_for(slot, pos + 1);
+        T item = slot.data;
+        publish(slot, pos + Capacity);
+        return item;
+    }
+
+    // Approximate: other threads may be mid-operation
+    size_t size() const {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+};
+
 // ============================================================================
 // Helper: Cache Line Size Constants
 // ============================================================================
@@ -0,0 +1,606 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "thread_registry.hpp"
+
+namespace atomics {
+
+// ============================================================================
+// Safe Memory Reclamation
+// ============================================================================
+//
+// A lock-free structure unlinks a node with one CAS, but another thread may
+// have loaded the pointer just before and still be reading the node. Deleting
+// it right away is a use-after-free; never deleting it is a leak. The ring
+// buffers and queues in this repo avoid the question (fixed slots, nothing
+// freed). Linked structures - depth lists, symbol maps, stacks - need one of:
+//
+//   HazardDomain  - each reader publishes the exact pointer it is using
+//                   ("hazard pointer"). A retired node is freed once no hazard
+//                   names it. Per-pointer cost on the read path (one store +
+//                   fence), but a stalled reader pins at most its own nodes:
+//                   unreclaimed memory is bounded by construction.
+//   EpochDomain   - readers only announce "I am inside a read section that
+//                   started in epoch e". A node retired in epoch r is freed
+//                   once the global epoch reaches r + 2, i.e. every reader has
+//                   left the sections that could have seen it. Per-section
+//                   cost (one barrier), nothing per pointer, but one stalled
+//                   reader holds back every node retired after it started.
+//
+// Both expose the same interface (see the Reclaimer concept below), so a
+// structure is written once and instantiated with either domain:
+//
+//   typename Domain::Guard guard(domain);     // Enter a read section
+//   Node* node = guard.protect(head_);        // Load a shared pointer safely
+//   ...unlink node with a CAS...
+//   domain.retire(node);                      // Freed once no reader can see it
+//
+// Retired nodes wait in a per-thread RetireList, so retire() touches no
+// shared cache line beyond the statistics counters. A list is scanned when it
+// reaches its capacity, which bounds what a thread can leave unreclaimed.
+
+// Records are indexed by hft::memory::ThreadRegistry, the process-wide
+// thread index shared with the memory pool and AtomicSharedPtr, so a thread's
+// hazard pointers, epoch and retire list live in its own cache lines. An index
+// returns to the registry when its thread exits; the next thread to get it
+// inherits its retire lists.
+inline constexpr size_t MAX_RECLAIM_THREADS = hft::memory::MAX_REGISTERED_THREADS;
+
+namespace detail {
+
+// This thread's record index (waits for one if every index is taken)
+inline size_t this_thread_record() {
+    return hft::memory::this_thread_index_wait();
+}
+
+inline size_t record_high_water() {
+    return hft::memory::ThreadRegistry::instance().high_water();
+}
+
+} // namespace detail
+
+// ============================================================================
+// Retire List (shared by both domains)
+// ============================================================================
+
+using Deleter = void (*)(void*) noexcept;
+
+struct Retired {
+    void* ptr;
+    Deleter deleter;
+    uint64_t epoch;  // EpochDomain: epoch the node was retired in (unused by HazardDomain)
+};
+
+// Nodes one thread has unlinked but not yet freed. Owned by that thread; the
+// domain decides when an entry is safe and calls reclaim_if().
+class RetireList {
+    std::vector<Retired> items_;
+
+public:
+    // Reserve once so retire() does not allocate on the hot path
+    void reserve(size_t capacity) {
+        items_.reserve(capacity);
+    }
+
+    void push(const Retired& item) {
+        items_.push_back(item);
+    }
+
+    size_t size() const { return items_.size(); }
+    bool empty() const { return items_.empty(); }
+
+    // Free every entry for which can_free(entry) is true, keep the rest.
+    // Returns the number freed. Order of the remaining entries is not kept.
+    template<typename CanFree>
+    size_t reclaim_if(CanFree&& can_free) {
+        size_t kept = 0;
+        for (size_t i = 0; i < items_.size(); ++i) {
+            if (can_free(items_[i])) {
+                items_[i].deleter(items_[i].ptr);
+            } else {
+                items_[kept++] = items_[i];
+            }
+        }
+        const size_t freed = items_.size() - kept;
+        items_.resize(kept);
+        return freed;
+    }
+
+    // Free everything (no reader may still hold any entry)
+    size_t reclaim_all() {
+        return reclaim_if([](const Retired&) { return true; });
+    }
+};
+
+// Counters for capacity planning; approximate while threads are running
+struct ReclaimStats {
+    size_t retired;        // retire() calls
+    size_t reclaimed;      // Nodes freed
+    size_t pending;        // retired - reclaimed
+    size_t peak_pending;   // High-water mark of pending
+    size_t scans;          // Times a retire list was scanned
+    size_t over_capacity;  // EpochDomain: retires that found the list full and could not wait
+};
+
+namespace detail {
+
+// Statistics shared by both domains (relaxed: writers only, off the read path)
+class ReclaimCounters {
+    alignas(64) std::atomic<size_t> retired_{0};
+    std::atomic<size_t> reclaimed_{0};
+    std::atomic<size_t> peak_pending_{0};
+    std::atomic<size_t> scans_{0};
+    std::atomic<size_t> over_capacity_{0};
+
+public:
+    void on_retire() {
+        const size_t retired = retired_.fetch_add(1, std::memory_order_relaxed) + 1;
+        const size_t pending = retired - reclaimed_.load(std::memory_order_relaxed);
+        size_t peak = peak_pending_.load(std::memory_order_relaxed);
+        while (pending > peak &&
+               !peak_pending_.compare_exchange_weak(peak, pending, std::memory_order_relaxed)) {
+        }
+    }
+
+    void on_scan(size_t freed) {
+        scans_.fetch_add(1, std::memory_order_relaxed);
+        reclaimed_.fetch_add(freed, std::memory_order_relaxed);
+    }
+
+    void on_over_capacity() {
+        over_capacity_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ReclaimStats snapshot() const {
+        const size_t reclaimed = reclaimed_.load(std::memory_order_relaxed);
+        const size_t retired = retired_.load(std::memory_order_relaxed);
+        return {retired, reclaimed, retired > reclaimed ? retired - reclaimed : 0,
+                peak_pending_.load(std::memory_order_relaxed),
+                scans_.load(std::memory_order_relaxed),
+                over_capacity_.load(std::memory_order_relaxed)};
+    }
+};
+
+template<typename T>
+void delete_object(void* ptr) noexcept {
+    delete static_cast<T*>(ptr);
+}
+
+} // namespace detail
+
+// ============================================================================
+// Hazard Pointers
+// ============================================================================
+//
+// Every thread owns SlotsPerThread hazard slots. A Guard borrows one slot and
+// protect() publishes the loaded pointer in it, then re-reads the source: if
+// the source still holds the pointer, any reclaimer that unlinks it later
+// will see the hazard (the seq_cst fence in scan() orders its hazard loads
+// after the unlink). A traversal holding two nodes (hand-over-hand) uses two
+// Guards.
+//
+// retire() appends to the thread's list; when the list reaches
+// 2 * (threads x SlotsPerThread) entries it is scanned: all hazards are
+// collected, sorted, and every entry not among them is freed. At most
+// (threads x SlotsPerThread) entries survive a scan, so each scan frees at
+// least half the list (amortized O(1) per retire) and a thread never holds
+// more than that capacity.
+//
+// At most SlotsPerThread Guards of one domain may be alive per thread.
+template<size_t SlotsPerThread = 4>
+class HazardDomain {
+    static_assert(SlotsPerThread >= 1 && SlotsPerThread <= 32, "Slot mask is 32 bits");
+
+    static constexpr size_t MAX_HAZARDS = MAX_RECLAIM_THREADS * SlotsPerThread;
+
+    struct Record {
+        alignas(64) std::array<std::atomic<void*>, SlotsPerThread> hazards{};  // Read by scanners
+        alignas(64) uint32_t used_slots{0};                                    // Owner only
+        RetireList retired;
+    };
+
+    std::array<Record, MAX_RECLAIM_THREADS> records_{};
+    detail::ReclaimCounters counters_;
+
+    Record& my_record() {
+        return records_[detail::this_thread_record()];
+    }
+
+    // Retire-list capacity that guarantees a scan frees at least half
+    static size_t scan_threshold(size_t threads) {
+        return std::max<size_t>(2 * threads * SlotsPerThread, 64);
+    }
+
+    void scan(Record& rec) {
+        // Order the hazard loads after this thread's unlinks (see protect())
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::array<void*, MAX_HAZARDS> hazards;
+        size_t count = 0;
+        const size_t threads = detail::record_high_water();
+        for (size_t t = 0; t < threads; ++t) {
+            for (const auto& slot : records_[t].hazards) {
+                if (void* p = slot.load(std::memory_order_acquire)) {
+                    hazards[count++] = p;
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.begin() + count);
+
+        const size_t freed = rec.retired.reclaim_if([&](const Retired& item) {
+            return !std::binary_search(hazards.begin(), hazards.begin() + count, item.ptr);
+        });
+        counters_.on_scan(freed);
+    }
+
+public:
+    class Guard {
+        HazardDomain& domain_;
+        Record& rec_;
+        uint32_t slot_;
+
+    public:
+        explicit Guard(HazardDomain& domain)
+            : domain_(domain), rec_(domain.my_record()), slot_(0) {
+            const uint32_t free_slots = ~rec_.used_slots & ((SlotsPerThread == 32) ? ~0u : ((1u << SlotsPerThread) - 1));
+            if (free_slots == 0) {
+                std::terminate();  // More than SlotsPerThread Guards alive on this thread
+            }
+            slot_ = static_cast<uint32_t>(std::countr_zero(free_slots));
+            rec_.used_slots |= 1u << slot_;
+        }
+
+        ~Guard() {
+            reset();
+            rec_.used_slots &= ~(1u << slot_);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // Load src and keep the result alive until reset() or the next protect()
+        template<typename T>
+        T* protect(const std::atomic<T*>& src) {
+            auto& hazard = rec_.hazards[slot_];
+            T* ptr = src.load(std::memory_order_relaxed);
+            while (true) {
+                hazard.store(ptr, std::memory_order_seq_cst);
+                T* again = src.load(std::memory_order_seq_cst);
+                if (again == ptr) {
+                    return ptr;
+                }
+                ptr = again;
+            }
+        }
+
+        // Stop protecting (release: our reads happen-before the node is freed)
+        void reset() {
+            rec_.hazards[slot_].store(nullptr, std::memory_order_release);
+        }
+    };
+
+    HazardDomain() = default;
+
+    // Frees everything still retired. No Guard may be alive.
+    ~HazardDomain() {
+        for (auto& rec : records_) {
+            rec.retired.reclaim_all();
+        }
+    }
+
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    // Free ptr once no hazard names it. Call after ptr is unreachable.
+    void retire(void* ptr, Deleter deleter) {
+        Record& rec = my_record();
+        const size_t threshold = scan_threshold(MAX_RECLAIM_THREADS);
+        if (rec.retired.empty()) {
+            rec.retired.reserve(threshold);
+        }
+        rec.retired.push({ptr, deleter, 0});
+        counters_.on_retire();
+        if (rec.retired.size() >= scan_threshold(detail::record_high_water())) {
+            scan(rec);
+        }
+    }
+
+    template<typename T>
+    void retire(T* ptr) {
+        retire(ptr, &detail::delete_object<T>);
+    }
+
+    // Scan this thread's retire list now (e.g. before a thread goes idle)
+    void reclaim() {
+        Record& rec = my_record();
+        if (!rec.retired.empty()) {
+            scan(rec);
+        }
+    }
+
+    ReclaimStats stats() const {
+        return counters_.snapshot();
+    }
+};
+
+// ============================================================================
+// Epoch-Based Reclamation
+// ============================================================================
+//
+// Three-epoch scheme (Fraser; crossbeam-epoch):
+// - Guard (outermost) copies the global epoch into the thread's record with
+//   a full barrier; nested Guards are free. protect() is a plain
+//   acquire load.
+// - retire() tags the node with the epoch the retiring thread is pinned in.
+// - The global epoch moves from g to g + 1 only when every thread inside a
+//   read section is pinned in g. A node retired in r is therefore safe once
+//   the global epoch reaches r + 2.
+//
+// Every Capacity / 8 retires a thread tries to advance the epoch and frees
+// what has become safe, so the epoch keeps moving with the writer. Each
+// thread's list is bounded by Capacity: when full, retire() tries once more;
+// if readers still hold the epoch back, a thread outside any Guard waits for
+// them (memory stays bounded, the writer blocks).
+// A thread retiring from inside its own Guard cannot wait on itself - the
+// list grows past Capacity and stats().over_capacity counts it.
+template<size_t Capacity = 1024>
+class EpochDomain {
+    static_assert(Capacity >= 8, "Retire list too small to amortize a scan");
+
+    static constexpr uint64_t QUIESCENT = UINT64_MAX;
+    static constexpr uint32_t COLLECT_INTERVAL = Capacity / 8;
+
+    struct Record {
+        alignas(64) std::atomic<uint64_t> epoch{QUIESCENT};  // Read by advancers
+        alignas(64) uint32_t depth{0};                       // Owner only: Guard nesting
+        uint32_t since_collect{0};                           // Owner only: retires since collect()
+        RetireList retired;
+    };
+
+    alignas(64) std::atomic<uint64_t> global_epoch_{0};
+    std::array<Record, MAX_RECLAIM_THREADS> records_{};
+    detail::ReclaimCounters counters_;
+
+    Record& my_record() {
+        return records_[detail::this_thread_record()];
+    }
+
+    void pin(Record& rec) {
+        if (rec.depth++ == 0) {
+            const uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+            // Announce before any protected load (store -> load ordering)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+            // Locked xchg is a full barrier on x86, and cheaper than the
+            // fence GCC emits (lock or on the stack): ~13 vs ~20 ns per pin
+            rec.epoch.exchange(epoch, std::memory_order_seq_cst);
+#else
+            rec.epoch.store(epoch, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+        }
+    }
+
+    void unpin(Record& rec) {
+        if (--rec.depth == 0) {
+            rec.epoch.store(QUIESCENT, std::memory_order_release);
+        }
+    }
+
+    // Advance the global epoch if every pinned thread has caught up with it
+    bool try_advance() {
+        const uint64_t global = global_epoch_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const size_t threads = detail::record_high_water();
+        for (size_t t = 0; t < threads; ++t) {
+            const uint64_t local = records_[t].epoch.load(std::memory_order_acquire);
+            if (local != QUIESCENT && local != global) {
+                return false;
+            }
+        }
+        uint64_t expected = global;
+        global_epoch_.compare_exchange_strong(expected, global + 1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    void collect(Record& rec) {
+        rec.since_collect = 0;
+        try_advance();
+        const uint64_t global = global_epoch_.load(std::memory_order_acquire);
+        const size_t freed = rec.retired.reclaim_if([global](const Retired& item) {
+            return item.epoch + 2 <= global;
+        });
+        counters_.on_scan(freed);
+    }
+
+public:
+    class Guard {
+        EpochDomain& domain_;
+        Record& rec_;
+
+    public:
+        explicit Guard(EpochDomain& domain) : domain_(domain), rec_(domain.my_record()) {
+            domain_.pin(rec_);
+        }
+
+        ~Guard() {
+            domain_.unpin(rec_);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        // Valid until the outermost Guard of this thread is destroyed
+        template<typename T>
+        T* protect(const std::atomic<T*>& src) {
+            return src.load(std::memory_order_acquire);
+        }
+
+        // Epoch protection covers the whole section; nothing to drop early
+        void reset() {}
+    };
+
+    EpochDomain() = default;
+
+    // Frees everything still retired. No Guard may be alive.
+    ~EpochDomain() {
+        for (auto& rec : records_) {
+            rec.retired.reclaim_all();
+        }
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // Free ptr once every reader that could have seen it has moved on.
+    // Call after ptr is unreachable.
+    void retire(void* ptr, Deleter deleter) {
+        Record& rec = my_record();
+        if (rec.retired.empty()) {
+            rec.retired.reserve(Capacity);
+        }
+
+        pin(rec);  // Tag with an epoch this thread is (or already was) pinned in
+        rec.retired.push({ptr, deleter, rec.epoch.load(std::memory_order_relaxed)});
+        counters_.on_retire();
+        const bool nested = rec.depth > 1;
+        unpin(rec);
+
+        if (rec.retired.size() < Capacity) {
+            if (++rec.since_collect >= COLLECT_INTERVAL) {
+                collect(rec);
+            }
+            return;
+        }
+        collect(rec);
+        if (rec.retired.size() < Capacity) {
+            return;
+        }
+        if (nested) {
+            counters_.on_over_capacity();  // Our own Guard holds the epoch back
+            return;
+        }
+        // Readers are holding the epoch back: wait for them to leave
+        while (rec.retired.size() >= Capacity) {
+            std::this_thread::yield();
+            collect(rec);
+        }
+    }
+
+    template<typename T>
+    void retire(T* ptr) {
+        retire(ptr, &detail::delete_object<T>);
+    }
+
+    // Try to advance the epoch and free this thread's eligible nodes
+    void reclaim() {
+        Record& rec = my_record();
+        if (!rec.retired.empty()) {
+            collect(rec);
+        }
+    }
+
+    uint64_t epoch() const {
+        return global_epoch_.load(std::memory_order_relaxed);
+    }
+
+    ReclaimStats stats() const {
+        return counters_.snapshot();
+    }
+};
+
+// ============================================================================
+// Common Interface
+// ============================================================================
+
+template<typename D>
+concept Reclaimer = requires(D& domain, typename D::Guard& guard, const std::atomic<int*>& src, int* ptr) {
+    { guard.protect(src) } -> std::same_as<int*>;
+    guard.reset();
+    domain.retire(ptr);
+    domain.retire(static_cast<void*>(ptr), Deleter{});
+    domain.reclaim();
+    { domain.stats() } -> std::same_as<ReclaimStats>;
+} && std::constructible_from<typename D::Guard, D&>;
+
+static_assert(Reclaimer<HazardDomain<>>);
+static_assert(Reclaimer<EpochDomain<>>);
+
+// ============================================================================
+// Example: Treiber Stack over Either Domain
+// ============================================================================
+//
+// The classic lock-free stack. Without reclamation, pop() reading top->next
+// races with another pop() deleting top; protect() closes that window, and
+// because a protected node cannot be freed and reused, the head CAS is also
+// safe from ABA.
+template<typename T, Reclaimer Domain>
+class LockFreeStack {
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    Domain& domain_;
+    alignas(64) std::atomic<Node*> head_{nullptr};
+
+public:
+    explicit LockFreeStack(Domain& domain) : domain_(domain) {}
+
+    // Single-threaded at destruction: nodes can be deleted directly
+    ~LockFreeStack() {
+        Node* node = head_.load(std::memory_order_relaxed);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    void push(const T& value) {
+        Node* node = new Node{value, head_.load(std::memory_order_relaxed)};
+        while (!head_.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    bool pop(T& out) {
+        Node* top;
+        {
+            typename Domain::Guard guard(domain_);
+            while (true) {
+                top = guard.protect(head_);
+                if (top == nullptr) {
+                    return false;
+                }
+                Node* next = top->next;  // Safe: top cannot be freed while protected
+                if (head_.compare_exchange_strong(top, next,
+                                                  std::memory_order_acquire, std::memory_order_relaxed)) {
+                    out = top->value;
+                    break;
+                }
+            }
+        }
+        // Outside the Guard, so EpochDomain::retire() may wait if its list is full
+        domain_.retire(top);
+        return true;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_relaxed) == nullptr;
+    }
+};
+
+} // namespace atomics
@@ -1,9 +1,13 @@
 #include "../include/atomic_examples.hpp"
+#include "../include/reclamation.hpp"
 #include <iostream>
 #include <iomanip>
 #include <thread>
 #include <chrono>
 #include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 using namespace atomics;
 using namespace std::chrono_literals;
@@ -345,6 +349,92 @@ void demo_relaxed_failure() {
     }
 }
 
+// ============================================================================
+// Demo 9: Lock-Free Stack Stress (Safe Reclamation)
+// ============================================================================
+//
+// Several threads push and pop the same LockFreeStack, so pops race with
+// pops that retire the node they are reading. Every value must come out
+// exactly once, and every popped node must go through the domain. Run under
+// -fsanitize=address or thread to catch a node freed while still protected.
+
+template<typename Domain>
+void stress_lock_free_stack(const char* domain_name) {
+    std::cout << "\n--- " << domain_name << " ---\n";
+
+    constexpr int NUM_THREADS = 4;
+    constexpr uint64_t VALUES_PER_THREAD = 50'000;
+    constexpr uint64_t TOTAL = NUM_THREADS * VALUES_PER_THREAD;
+
+    auto domain = std::make_unique<Domain>();
+    LockFreeStack<uint64_t, Domain> stack(*domain);
+    std::vector<std::atomic<uint8_t>> seen(TOTAL);
+    std::atomic<uint64_t> popped{0};
+
+    auto take = [&](uint64_t value) {
+        seen[value].fetch_add(1, std::memory_order_relaxed);
+        popped.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads.emplace_back([&, t]() {
+            const uint64_t first = t * VALUES_PER_THREAD;
+            uint64_t value;
+            // Push two, pop one: the stack stays shallow so pops contend on the head
+            for (uint64_t i = 0; i < VALUES_PER_THREAD; i++) {
+                stack.push(first + i);
+                if ((i & 1) && stack.pop(value)) {
+                    take(value);
+                }
+            }
+            while (stack.pop(value)) {
+                take(value);
+            }
+            domain->reclaim();
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    uint64_t missing = 0;
+    uint64_t duplicated = 0;
+    for (const auto& count : seen) {
+        const uint8_t n = count.load(std::memory_order_relaxed);
+        missing += (n == 0);
+        duplicated += (n > 1);
+    }
+    const ReclaimStats stats = domain->stats();
+
+    std::cout << "Threads: " << NUM_THREADS << ", values pushed: " << TOTAL << "\n";
+    std::cout << "Values popped: " << popped.load() << " (missing " << missing
+              << ", duplicated " << duplicated << ")\n";
+    std::cout << "Nodes retired: " << stats.retired << ", reclaimed: " << stats.reclaimed
+              << ", still pending: " << stats.pending << " (peak " << stats.peak_pending << ")\n";
+    std::cout << "Duration: " << duration.count() << " us\n";
+
+    // Checked in Release builds too: a lost or doubled value is a reclamation bug
+    if (popped.load() != TOTAL || missing != 0 || duplicated != 0 || !stack.empty() ||
+        stats.retired != TOTAL || stats.reclaimed > stats.retired) {
+        throw std::runtime_error(std::string("LockFreeStack stress failed with ") + domain_name);
+    }
+    std::cout << "[PASS] Every value popped exactly once, every node retired!\n";
+}
+
+void demo_lock_free_stack_stress() {
+    std::cout << "\n=== Demo 9: Lock-Free Stack Stress (Hazard Pointers / Epochs) ===\n";
+
+    stress_lock_free_stack<HazardDomain<>>("HazardDomain");
+    stress_lock_free_stack<EpochDomain<>>("EpochDomain");
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -364,6 +454,7 @@ int main() {
         demo_work_queue();
         demo_seq_cst();
         demo_relaxed_failure();
+        demo_lock_free_stack_stress();
 
         std::cout << "\n==============================================\n";
         std::cout << "           All Demos Completed!               \n";
@@ -0,0 +1,204 @@
+// benchmarks/bench_book_memory.cpp
+//
+// Order-book memory on the heap vs. on huge-page, pre-faulted mappings
+//
+// - Ladder: random updates across a full 20M-level price ladder (320 MB per
+//   side), i.e. what a fast market does to the dense ladder
+// - OrderIndex: add/find/erase on an order map with a pre-reserved bucket
+//   array (1M orders)
+// - FirstTouch: constructing and touching a fresh ladder, where pre-faulting
+//   moves the page faults out of the measured region
+//
+// "dTLB_miss/op" needs a PMU (often absent in VMs: reported as -1);
+// "faults/op" uses the kernel's software counter and is always available.
+//
+// Run: ./benchmarks/bench_book_memory --benchmark_counters_tabular=true
+
+#include "common/mapped_memory.hpp"
+#include "common/types.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace hft;
+
+namespace {
+
+    constexpr size_t LADDER_LEVELS = 2000 * 10000;  // Same range as OrderBook
+    constexpr size_t NUM_ORDERS = 1 << 20;
+    constexpr size_t OPS_PER_ITERATION = 1 << 16;
+
+    /// One perf event for the calling thread; count() is -1 where unsupported
+    class PerfCounter {
+    public:
+#if defined(__linux__)
+        PerfCounter(uint32_t type, uint64_t config) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.exclude_hv = 1;
+            fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+        ~PerfCounter() {
+            if (fd_ >= 0) {
+                close(fd_);
+            }
+        }
+        PerfCounter(const PerfCounter&) = delete;
+        PerfCounter& operator=(const PerfCounter&) = delete;
+
+        double count() const {
+            uint64_t value = 0;
+            if (fd_ < 0 || read(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+                return -1;
+            }
+            return static_cast<double>(value);
+        }
+
+    private:
+        int fd_{-1};
+#else
+        PerfCounter(uint32_t, uint64_t) {}
+        double count() const { return -1; }
+#endif
+    };
+
+#if defined(__linux__)
+    PerfCounter dtlb_misses() {
+        return PerfCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    }
+    PerfCounter page_faults() {
+        return PerfCounter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+    }
+#else
+    PerfCounter dtlb_misses() { return PerfCounter(0, 0); }
+    PerfCounter page_faults() { return PerfCounter(0, 0); }
+#endif
+
+    /// Per-op deltas of both counters over the benchmark loop
+    struct CounterScope {
+        PerfCounter dtlb = dtlb_misses();
+        PerfCounter faults = page_faults();
+        double dtlb_start = dtlb.count();
+        double faults_start = faults.count();
+
+        void report(benchmark::State& state, size_t ops_per_iteration) const {
+            const double ops = static_cast<double>(state.iterations() * ops_per_iteration);
+            state.SetItemsProcessed(static_cast<int64_t>(ops));
+            const double d = dtlb.count();
+            state.counters["dTLB_miss/op"] = d < 0 ? -1 : (d - dtlb_start) / ops;
+            state.counters["faults/op"] = (faults.count() - faults_start) / ops;
+        }
+    };
+
+    template <typename T>
+    MappedAllocator<T> allocator_for(int64_t mapped) {
+        return mapped ? MappedAllocator<T>(BackingOptions{HugePages::TRANSPARENT, true, false})
+                      : MappedAllocator<T>();
+    }
+
+    /// Uniformly random ladder indices: worst case for the TLB (real quotes cluster near the touch)
+    std::vector<uint32_t> random_levels() {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<uint32_t> dist(0, LADDER_LEVELS - 1);
+        std::vector<uint32_t> levels(OPS_PER_ITERATION);
+        for (auto& level : levels) {
+            level = dist(rng);
+        }
+        return levels;
+    }
+
+} // namespace
+
+// range(0): 0 = heap (std::allocator), 1 = THP + populate
+static void BM_Ladder_RandomUpdate(benchmark::State& state) {
+    std::vector<PriceLevel, MappedAllocator<PriceLevel>> ladder(
+        LADDER_LEVELS, PriceLevel{}, allocator_for<PriceLevel>(state.range(0)));
+    const auto levels = random_levels();
+
+    CounterScope counters;
+    for (auto _ : state) {
+        for (uint32_t level : levels) {
+            ladder[level].quantity += 100;
+            ladder[level].order_count++;
+        }
+        benchmark::ClobberMemory();
+    }
+    counters.report(state, OPS_PER_ITERATION);
+}
+
+static void BM_OrderIndex_AddFindErase(benchmark::State& state) {
+    struct Order {
+        Price price;
+        uint32_t shares;
+        Side side;
+    };
+    using Index = std::unordered_map<uint64_t, Order, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                     MappedAllocator<std::pair<const uint64_t, Order>>>;
+
+    Index orders(allocator_for<std::pair<const uint64_t, Order>>(state.range(0)));
+    orders.reserve(NUM_ORDERS);
+    for (uint64_t ref = 0; ref < NUM_ORDERS / 2; ++ref) {
+        orders[ref * 7919] = {static_cast<Price>(ref), 100, Side::BUY};
+    }
+
+    std::mt19937_64 rng(7);
+    uint64_t next_ref = NUM_ORDERS / 2;
+    CounterScope counters;
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < OPS_PER_ITERATION; ++i) {
+            // Steady state: one add, one lookup of a resting order, one removal
+            orders[next_ref * 7919] = {static_cast<Price>(next_ref), 100, Side::SELL};
+            auto it = orders.find((rng() % next_ref) * 7919);
+            sum += it != orders.end() ? it->second.shares : 0;
+            orders.erase((next_ref - NUM_ORDERS / 2) * 7919);
+            ++next_ref;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    counters.report(state, OPS_PER_ITERATION);
+}
+
+// First write of every page of a fresh mapping; range(0) = THP, range(1) = populate
+static void BM_Ladder_FirstTouch(benchmark::State& state) {
+    constexpr size_t LEVELS = 1 << 22;  // 64 MB
+    const BackingOptions backing{state.range(0) ? HugePages::TRANSPARENT : HugePages::NONE,
+                                 state.range(1) != 0, false};
+
+    CounterScope counters;
+    for (auto _ : state) {
+        state.PauseTiming();
+        MappedRegion region(LEVELS * sizeof(PriceLevel), backing);
+        state.ResumeTiming();
+
+        auto* ladder = static_cast<PriceLevel*>(region.data());
+        for (size_t i = 0; i < LEVELS; i += MappedRegion::PAGE_SIZE / sizeof(PriceLevel)) {
+            ladder[i].quantity = 1;
+        }
+        benchmark::ClobberMemory();
+
+        state.PauseTiming();
+        region = MappedRegion();
+        state.ResumeTiming();
+    }
+    counters.report(state, LEVELS / (MappedRegion::PAGE_SIZE / sizeof(PriceLevel)));
+}
+
+BENCHMARK(BM_Ladder_RandomUpdate)->ArgName("mapped")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_OrderIndex_AddFindErase)->ArgName("mapped")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Ladder_FirstTouch)->ArgNames({"thp", "populate"})
+    ->Args({0, 0})->Args({0, 1})->Args({1, 0})->Args({1, 1})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,200 @@
+// benchmarks/bench_byte_ring.cpp
+//
+// Feed-handler -> book hand-off: fixed-slot ring of parsed ITCHMessage
+// variants vs. variable-length byte ring of raw ITCH messages
+//
+// The message mix is what dominates a real feed (adds, deletes, cancels,
+// executions, plus the odd system event), 12-36 bytes on the wire. Every
+// ITCHMessage slot is sizeof(ITCHMessage) bytes regardless of the type it
+// holds; the byte ring stores each message at its wire size rounded up to 8
+// plus a 4-byte length. "ring_bytes/msg" reports the resulting footprint.
+//
+// Each iteration pushes a batch through the ring and drains it on the same
+// thread, so the numbers are per-message ring cost plus (for the *_Parse
+// variants) one parse, not cross-core transfer.
+//
+// Run: ./benchmarks/bench_byte_ring --benchmark_counters_tabular=true
+
+#include "common/byte_ring.hpp"
+#include "itch/messages.hpp"
+#include "ring_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace hft;
+using namespace hft::itch;
+
+namespace {
+
+    constexpr size_t BATCH = 1024;
+
+    using FixedRing = core::RingBuffer<ITCHMessage, 4096>;
+    using RawRing = ByteRing<1 << 16>;
+
+    void put_be(std::vector<uint8_t>& msg, size_t offset, uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            msg[offset + i] = static_cast<uint8_t>(value >> (8 * (bytes - 1 - i)));
+        }
+    }
+
+    /// Raw wire message: type, stock locate, tracking number, 6-byte timestamp
+    std::vector<uint8_t> make_message(char type, size_t length, uint64_t i) {
+        std::vector<uint8_t> msg(length, 0);
+        msg[0] = static_cast<uint8_t>(type);
+        put_be(msg, 1, 1, 2);
+        put_be(msg, 5, 34'200'000'000'000ULL + i, 6);
+        if (length >= 19) {
+            put_be(msg, 11, 1000 + i, 8);  // Order reference
+        }
+        return msg;
+    }
+
+    /// Order-flow heavy mix of messages, each checked to parse
+    std::vector<std::vector<uint8_t>> make_feed() {
+        std::vector<std::vector<uint8_t>> feed;
+        feed.reserve(BATCH);
+        for (uint64_t i = 0; i < BATCH; ++i) {
+            std::vector<uint8_t> msg;
+            switch (i % 8) {
+            case 0: case 1: case 2:
+                msg = make_message('A', 36, i);
+                msg[19] = 'B';                                 // Side
+                put_be(msg, 20, 100, 4);                       // Shares
+                std::memcpy(&msg[24], "MSFT    ", 8);          // Stock
+                put_be(msg, 32, 1500000, 4);                   // Price
+                break;
+            case 3: case 4:
+                msg = make_message('D', 19, i);
+                break;
+            case 5:
+                msg = make_message('X', 23, i);
+                put_be(msg, 19, 50, 4);                        // Cancelled shares
+                break;
+            case 6:
+                msg = make_message('E', 31, i);
+                put_be(msg, 19, 50, 4);                        // Executed shares
+                put_be(msg, 23, i, 8);                         // Match number
+                break;
+            default:
+                msg = make_message('S', 12, i);
+                msg[11] = 'Q';                                 // Event code
+                break;
+            }
+            if (!parse_message(msg.data(), msg.size()).is_success()) {
+                std::abort();
+            }
+            feed.push_back(std::move(msg));
+        }
+        return feed;
+    }
+
+    const std::vector<std::vector<uint8_t>>& feed() {
+        static const auto messages = make_feed();
+        return messages;
+    }
+
+    /// Stand-in for the book handler: touch the decoded message
+    inline uint64_t consume(const ITCHMessage& msg) {
+        return msg.index();
+    }
+
+    void set_counters(benchmark::State& state, double ring_bytes) {
+        state.SetItemsProcessed(state.iterations() * BATCH);
+        state.counters["ring_bytes/msg"] = ring_bytes / BATCH;
+    }
+
+    double raw_ring_bytes() {
+        double total = 0;
+        for (const auto& msg : feed()) {
+            total += static_cast<double>(RawRing::record_size(msg.size()));
+        }
+        return total;
+    }
+
+} // namespace
+
+// Transport only: pre-parsed variants through fixed slots
+static void BM_FixedRing_Transport(benchmark::State& state) {
+    auto ring = std::make_unique<FixedRing>();
+    std::vector<ITCHMessage> parsed;
+    for (const auto& msg : feed()) {
+        parsed.push_back(*parse_message(msg.data(), msg.size()).message);
+    }
+
+    for (auto _ : state) {
+        for (const auto& msg : parsed) {
+            (void)ring->try_push(msg);
+        }
+        uint64_t sum = 0;
+        while (auto out = ring->try_pop()) {
+            sum += consume(*out);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, static_cast<double>(sizeof(ITCHMessage) * BATCH));
+}
+
+// Transport only: raw wire bytes, consumer reads the type byte in place
+static void BM_ByteRing_Transport(benchmark::State& state) {
+    auto ring = std::make_unique<RawRing>();
+
+    for (auto _ : state) {
+        for (const auto& msg : feed()) {
+            (void)ring->try_push(msg.data(), msg.size());
+        }
+        uint64_t sum = 0;
+        for (auto record = ring->peek(); !record.empty(); record = ring->peek()) {
+            sum += record[0];
+            ring->pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, raw_ring_bytes());
+}
+
+// Producer parses, ring carries the 72-byte variant
+static void BM_FixedRing_Parse(benchmark::State& state) {
+    auto ring = std::make_unique<FixedRing>();
+
+    for (auto _ : state) {
+        for (const auto& msg : feed()) {
+            auto result = parse_message(msg.data(), msg.size());
+            (void)ring->try_push(*result.message);
+        }
+        uint64_t sum = 0;
+        while (auto out = ring->try_pop()) {
+            sum += consume(*out);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, static_cast<double>(sizeof(ITCHMessage) * BATCH));
+}
+
+// Ring carries wire bytes, consumer parses in place
+static void BM_ByteRing_Parse(benchmark::State& state) {
+    auto ring = std::make_unique<RawRing>();
+
+    for (auto _ : state) {
+        for (const auto& msg : feed()) {
+            (void)ring->try_push(msg.data(), msg.size());
+        }
+        uint64_t sum = 0;
+        for (auto record = ring->peek(); !record.empty(); record = ring->peek()) {
+            auto result = parse_message(record.data(), record.size());
+            sum += consume(*result.message);
+            ring->pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, raw_ring_bytes());
+}
+
+BENCHMARK(BM_FixedRing_Transport);
+BENCHMARK(BM_ByteRing_Transport);
+BENCHMARK(BM_FixedRing_Parse);
+BENCHMARK(BM_ByteRing_Parse);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+// benchmarks/bench_moldudp64.cpp
+//
+// MoldUDP64 packet parsing: per-packet std::vector vs. zero-allocation views
+//
+// All three variants validate the full datagram and touch every message block
+// (length + first byte), so the difference is purely the block container.
+//
+// Run: ./benchmarks/bench_moldudp64 --benchmark_counters_tabular=true
+
+#include "network/moldudp64.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace hft::network;
+
+namespace {
+
+    /// Build a data packet with `count` AddOrder-sized (36 byte) messages
+    std::vector<uint8_t> make_packet(uint16_t count) {
+        const char session[] = "BENCH00001";
+        std::vector<uint8_t> packet(session, session + protocol::SESSION_ID_LENGTH);
+
+        const uint64_t seq = 1;
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            packet.push_back(static_cast<uint8_t>(seq >> shift));
+        }
+        packet.push_back(static_cast<uint8_t>(count >> 8));
+        packet.push_back(static_cast<uint8_t>(count & 0xFF));
+
+        constexpr uint16_t MSG_LEN = 36;
+        for (uint16_t i = 0; i < count; ++i) {
+            packet.push_back(0);
+            packet.push_back(MSG_LEN);
+            packet.push_back('A');
+            packet.insert(packet.end(), MSG_LEN - 1, static_cast<uint8_t>(i));
+        }
+        return packet;
+    }
+
+    void set_counters(benchmark::State& state) {
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["packets/s"] = benchmark::Counter(
+            static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+
+} // namespace
+
+static void BM_MoldUDP64_ParseVector(benchmark::State& state) {
+    auto data = make_packet(static_cast<uint16_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto packet = MoldUDP64Packet::parse(data.data(), data.size());
+        uint64_t sum = 0;
+        for (const auto& block : packet->messages) {
+            sum += block.length + block.data[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state);
+}
+
+static void BM_MoldUDP64_ParseView(benchmark::State& state) {
+    auto data = make_packet(static_cast<uint16_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto view = MoldUDP64PacketView::parse(data.data(), data.size());
+        uint64_t sum = 0;
+        for (MessageBlock block : *view) {
+            sum += block.length + block.data[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state);
+}
+
+static void BM_MoldUDP64_ParseInline(benchmark::State& state) {
+    auto data = make_packet(static_cast<uint16_t>(state.range(0)));
+    MoldUDP64InlinePacket packet;  // Reused across packets, as on a receive thread
+
+    for (auto _ : state) {
+        bool ok = packet.parse(data.data(), data.size());
+        uint64_t sum = ok;
+        for (const auto& block : packet) {
+            sum += block.length + block.data[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state);
+}
+
+// Gap detection per packet: session check + sequence update. Arg(1) pins an
+// expected session, which adds a second fingerprint compare.
+static void BM_SequenceTracker_ProcessPacket(benchmark::State& state) {
+    auto data = make_packet(1);
+    auto header = MoldUDP64Header::parse(data.data(), data.size()).value();
+    SequenceTracker tracker;
+    if (state.range(0)) {
+        (void)tracker.set_expected_session("BENCH00001");
+    }
+
+    for (auto _ : state) {
+        header.sequence_number = tracker.expected_sequence();  // Always in order
+        auto info = tracker.process_packet(header);
+        benchmark::DoNotOptimize(info);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 1 = sparse feed, 8 = typical, 38 = MTU-filling AddOrder burst
+BENCHMARK(BM_MoldUDP64_ParseVector)->Arg(1)->Arg(8)->Arg(38);
+BENCHMARK(BM_MoldUDP64_ParseView)->Arg(1)->Arg(8)->Arg(38);
+BENCHMARK(BM_MoldUDP64_ParseInline)->Arg(1)->Arg(8)->Arg(38);
+BENCHMARK(BM_SequenceTracker_ProcessPacket)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+// benchmarks/bench_replay_arena.cpp
+//
+// Replay pipeline (MoldUDP64 -> ITCH parse -> per-packet batch) with its
+// scratch allocations on the global heap vs. a per-packet arena
+//
+// Per packet: MoldUDP64Packet::parse (block vector), parse_message for every
+// block (~1 in 64 malformed, so ParseResult carries an error string), and a
+// temporary vector batching the decoded messages. Everything is dropped at
+// the end of the packet:
+// - heap:      std::pmr::new_delete_resource() (same as the non-pmr overloads)
+// - arena:     MonotonicArena, reset() per packet
+// - std_mono:  std::pmr::monotonic_buffer_resource on a fixed buffer,
+//              release() per packet
+//
+// Run: ./benchmarks/bench_replay_arena --benchmark_counters_tabular=true
+
+#include "common/arena.hpp"
+#include "itch/messages.hpp"
+#include "network/moldudp64.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+using namespace hft;
+
+namespace {
+
+    constexpr size_t NUM_PACKETS = 1024;
+
+    /// Synthetic capture: AddOrder-heavy mix, 1-38 messages per packet
+    std::vector<std::vector<uint8_t>> make_feed(size_t messages_per_packet) {
+        std::mt19937 rng(11);
+        std::vector<std::vector<uint8_t>> feed;
+        uint64_t sequence = 1;
+
+        for (size_t p = 0; p < NUM_PACKETS; ++p) {
+            std::vector<uint8_t> packet;
+            const char session[] = "REPLAY0001";
+            packet.insert(packet.end(), session, session + network::protocol::SESSION_ID_LENGTH);
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                packet.push_back(static_cast<uint8_t>(sequence >> shift));
+            }
+            const auto count = static_cast<uint16_t>(messages_per_packet);
+            packet.push_back(static_cast<uint8_t>(count >> 8));
+            packet.push_back(static_cast<uint8_t>(count & 0xFF));
+
+            for (uint16_t i = 0; i < count; ++i) {
+                const uint32_t roll = rng() % 64;
+                size_t length = itch::AddOrder::SIZE;
+                char type = 'A';
+                if (roll == 0) {
+                    type = '?';  // Malformed: error path
+                } else if (roll < 20) {
+                    length = itch::OrderDelete::SIZE;
+                    type = 'D';
+                } else if (roll < 28) {
+                    length = itch::OrderExecuted::SIZE;
+                    type = 'E';
+                }
+                packet.push_back(static_cast<uint8_t>(length >> 8));
+                packet.push_back(static_cast<uint8_t>(length & 0xFF));
+                packet.push_back(static_cast<uint8_t>(type));
+                packet.insert(packet.end(), length - 1, static_cast<uint8_t>(rng()));
+            }
+            sequence += count;
+            feed.push_back(std::move(packet));
+        }
+        return feed;
+    }
+
+    struct Totals {
+        uint64_t messages = 0;
+        uint64_t errors = 0;
+    };
+
+    /// One packet through the pipeline; every allocation comes from `resource`
+    void process_packet(const std::vector<uint8_t>& datagram, std::pmr::memory_resource* resource,
+                        Totals& totals) {
+        auto packet = network::MoldUDP64Packet::parse(datagram.data(), datagram.size(), resource);
+        if (!packet) {
+            return;
+        }
+
+        std::pmr::vector<itch::ITCHMessage> batch(resource);
+        batch.reserve(packet->messages.size());
+        for (const auto& block : packet->messages) {
+            auto result = itch::parse_message(block.data, block.length, resource);
+            if (!result.is_success()) {
+                totals.errors += result.error_detail.size();
+                continue;
+            }
+            batch.push_back(std::move(*result.message));
+        }
+        totals.messages += batch.size();
+        benchmark::DoNotOptimize(batch.data());
+    }
+
+    void set_counters(benchmark::State& state, const Totals& totals) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_PACKETS * state.range(0)));
+        state.counters["packets/s"] = benchmark::Counter(
+            static_cast<double>(state.iterations() * NUM_PACKETS), benchmark::Counter::kIsRate);
+        benchmark::DoNotOptimize(totals.messages + totals.errors);
+    }
+
+} // namespace
+
+// range(0): messages per packet
+static void BM_Replay_Heap(benchmark::State& state) {
+    const auto feed = make_feed(static_cast<size_t>(state.range(0)));
+    Totals totals;
+    for (auto _ : state) {
+        for (const auto& datagram : feed) {
+            process_packet(datagram, std::pmr::new_delete_resource(), totals);
+        }
+    }
+    set_counters(state, totals);
+}
+
+static void BM_Replay_Arena(benchmark::State& state) {
+    const auto feed = make_feed(static_cast<size_t>(state.range(0)));
+    MonotonicArena arena;
+    Totals totals;
+    for (auto _ : state) {
+        for (const auto& datagram : feed) {
+            process_packet(datagram, &arena, totals);
+            arena.reset();
+        }
+    }
+    set_counters(state, totals);
+    state.counters["high_water"] = static_cast<double>(arena.high_water());
+    state.counters["overflows"] = static_cast<double>(arena.overflow_count());
+}
+
+static void BM_Replay_StdMonotonic(benchmark::State& state) {
+    const auto feed = make_feed(static_cast<size_t>(state.range(0)));
+    alignas(64) static std::array<std::byte, MonotonicArena::DEFAULT_CAPACITY> buffer;
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+    Totals totals;
+    for (auto _ : state) {
+        for (const auto& datagram : feed) {
+            process_packet(datagram, &resource, totals);
+            resource.release();
+        }
+    }
+    set_counters(state, totals);
+}
+
+// 1 = sparse feed, 8 = typical, 38 = MTU-filling AddOrder burst
+BENCHMARK(BM_Replay_Heap)->Arg(1)->Arg(8)->Arg(38)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Replay_Arena)->Arg(1)->Arg(8)->Arg(38)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Replay_StdMonotonic)->Arg(1)->Arg(8)->Arg(38)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
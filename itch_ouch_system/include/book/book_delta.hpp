@@ -0,0 +1,127 @@
+#pragma once
+// include/book/book_delta.hpp
+//
+// Incremental L2 updates published by OrderBook
+//
+// Every price level an OrderBook changes is reported as one fixed-size
+// BookDelta carrying the level's NEW absolute state (quantity and order
+// count). Absolute values make deltas idempotent, which gives us two things:
+// - Coalescing: a level touched several times within one MoldUDP64 packet
+//   (OrderBook::begin_batch / end_batch) is published once, with its final state.
+// - Conflation under backpressure: if the ring is full, unpublished levels
+//   stay dirty and are re-sent with their latest state on the next flush,
+//   so consumers converge to the producer's book without gaps or resync.
+//
+// The last delta of each batch carries END_OF_BATCH; a consumer's book is
+// consistent with the producer's at that MoldUDP64 sequence.
+
+#include "common/types.hpp"
+#include "ring_buffer.hpp"
+#include "book/snapshot.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace hft {
+
+    namespace delta_flags {
+        constexpr uint8_t END_OF_BATCH = 0x01;  // Book is consistent after applying this delta
+    } // namespace delta_flags
+
+    /// One price-level change (32 bytes, two per cache line)
+    struct BookDelta {
+        uint64_t sequence{0};      // Last MoldUDP64 sequence applied when published
+        Price price{0};
+        Quantity quantity{0};      // New total shares at the level (0 = level removed)
+        uint32_t order_count{0};   // New number of orders at the level
+        uint16_t stock_locate{0};
+        Side side{Side::BUY};
+        uint8_t flags{0};          // delta_flags
+        uint8_t reserved[4]{};
+
+        bool end_of_batch() const { return (flags & delta_flags::END_OF_BATCH) != 0; }
+    };
+    static_assert(sizeof(BookDelta) == 32, "BookDelta should stay two per cache line");
+    static_assert(std::is_trivially_copyable_v<BookDelta>);
+
+    /// Ring between one OrderBook (producer) and one consumer thread.
+    /// 02_ring_buffer's RingBuffer: one slot stays empty, so it holds 8191 deltas.
+    using BookDeltaRing = core::RingBuffer<BookDelta, 8192>;
+
+    /**
+     * @class L2Book
+     * @brief Consumer-side L2 book rebuilt purely from BookDelta records.
+     *
+     * Sparse (std::map per side): consumers typically hold far fewer levels
+     * than the producer's dense ladder and are not on the feed's critical path.
+     */
+    class L2Book {
+    public:
+        void apply(const BookDelta& delta) {
+            if (delta.side == Side::BUY) {
+                update(bids_, delta);
+            } else {
+                update(asks_, delta);
+            }
+            if (delta.end_of_batch()) {
+                consistent_sequence_ = delta.sequence;
+            }
+        }
+
+        /// Drain everything currently in `ring`; returns the number of deltas applied
+        size_t drain(BookDeltaRing& ring) {
+            size_t applied = 0;
+            while (auto delta = ring.try_pop()) {
+                apply(*delta);
+                ++applied;
+            }
+            return applied;
+        }
+
+        std::optional<PriceLevel> best_bid() const {
+            if (bids_.empty()) return std::nullopt;
+            return bids_.begin()->second;
+        }
+
+        std::optional<PriceLevel> best_ask() const {
+            if (asks_.empty()) return std::nullopt;
+            return asks_.begin()->second;
+        }
+
+        size_t depth(Side side) const { return side == Side::BUY ? bids_.size() : asks_.size(); }
+
+        /// MoldUDP64 sequence of the last complete batch applied
+        uint64_t consistent_sequence() const { return consistent_sequence_; }
+
+        /// All levels in BookSnapshot::build_levels() order (bids best-first, then asks best-first)
+        std::vector<SnapshotLevel> levels() const {
+            std::vector<SnapshotLevel> out;
+            out.reserve(bids_.size() + asks_.size());
+            for (const auto& [price, level] : bids_) {
+                out.push_back({price, level.quantity, level.order_count, Side::BUY});
+            }
+            for (const auto& [price, level] : asks_) {
+                out.push_back({price, level.quantity, level.order_count, Side::SELL});
+            }
+            return out;
+        }
+
+    private:
+        template <typename Map>
+        static void update(Map& side, const BookDelta& delta) {
+            if (delta.quantity == 0) {
+                side.erase(delta.price);
+            } else {
+                side[delta.price] = {delta.price, delta.quantity, delta.order_count};
+            }
+        }
+
+        std::map<Price, PriceLevel, std::greater<Price>> bids_;
+        std::map<Price, PriceLevel, std::less<Price>> asks_;
+        uint64_t consistent_sequence_{0};
+    };
+
+} // namespace hft
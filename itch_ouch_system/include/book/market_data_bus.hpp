@@ -0,0 +1,180 @@
+#pragma once
+// include/book/market_data_bus.hpp
+//
+// Shared-memory market data bus
+//
+// One book-builder process publishes per-symbol top-of-book and depth into a
+// POSIX shared-memory segment; any number of strategy processes on the same
+// box map it read-only and read books without rebuilding them.
+//
+// Segment layout (fixed at creation, position-independent - no pointers):
+//   BusHeader                        (one cache line)
+//   BusSymbolSlot x max_symbols      (each slot cache-line aligned)
+//
+// Synchronization:
+// - Slot directory (symbol, stock locate) is written once, then published by
+//   a release store of BusHeader::symbol_count. Readers discover symbols by
+//   scanning the first symbol_count slots.
+// - Top-of-book and depth are each guarded by their own SeqLock, so a reader
+//   of one symbol never contends with writes to another.
+// - Attaching and detaching are syscalls (shm_open/mmap/munmap); reading,
+//   discovery and liveness checks are plain loads.
+
+#include "common/types.hpp"
+#include "book/seqlock.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace hft {
+
+    class OrderBook;
+
+    namespace bus {
+        constexpr uint64_t MAGIC = 0x5355424154444D48ULL;  // "HMDTABUS" (little-endian)
+        constexpr uint32_t VERSION = 2;
+        constexpr size_t DEPTH_LEVELS = 10;
+
+        /// Writer lifecycle, visible to readers without syscalls
+        enum class State : uint32_t {
+            INITIALIZING = 0,
+            LIVE = 1,
+            CLOSED = 2,  // Writer shut down cleanly; readers should detach
+        };
+    } // namespace bus
+
+    /// Best N levels per side
+    struct BusDepth {
+        uint64_t sequence{0};  // Last MoldUDP64 sequence reflected
+        uint32_t bid_count{0};
+        uint32_t ask_count{0};
+        std::array<PriceLevel, bus::DEPTH_LEVELS> bids{};  // Best first
+        std::array<PriceLevel, bus::DEPTH_LEVELS> asks{};  // Best first
+    };
+
+    struct alignas(64) BusHeader {
+        uint64_t magic{0};
+        uint32_t version{0};
+        uint32_t max_symbols{0};
+        uint64_t segment_size{0};
+        std::atomic<uint32_t> state{static_cast<uint32_t>(bus::State::INITIALIZING)};
+        std::atomic<uint32_t> symbol_count{0};
+        std::atomic<int32_t> writer_pid{0};  // Owning process, checked before replacing the segment
+    };
+
+    struct alignas(64) BusSymbolSlot {
+        // Directory entry: immutable once counted in BusHeader::symbol_count
+        std::array<char, 8> symbol{};  // Space-padded
+        uint16_t stock_locate{0};
+
+        SeqLock<TopOfBook> top;
+        SeqLock<BusDepth> depth;
+    };
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+    /// Total bytes for a segment holding `max_symbols` slots
+    constexpr size_t bus_segment_size(uint32_t max_symbols) {
+        return sizeof(BusHeader) + static_cast<size_t>(max_symbols) * sizeof(BusSymbolSlot);
+    }
+
+    /**
+     * @class MarketDataBusWriter
+     * @brief Creates and owns the segment; the single writer for every slot.
+     *
+     * Unlinks the segment name on destruction (readers that are still
+     * attached keep their mapping and see State::CLOSED). A name is owned by
+     * one writer at a time: create() refuses it while the process recorded
+     * in the header is alive, and replaces it only once that process is gone.
+     */
+    class MarketDataBusWriter {
+    public:
+        /// Create the segment `name` (e.g. "/hft_md_bus"), replacing one left
+        /// by a crashed writer; nullopt if a live writer still owns the name
+        static std::optional<MarketDataBusWriter> create(const std::string& name, uint32_t max_symbols);
+
+        MarketDataBusWriter(MarketDataBusWriter&& other) noexcept;
+        MarketDataBusWriter& operator=(MarketDataBusWriter&&) = delete;
+        MarketDataBusWriter(const MarketDataBusWriter&) = delete;
+        MarketDataBusWriter& operator=(const MarketDataBusWriter&) = delete;
+        ~MarketDataBusWriter();
+
+        /// Register a symbol; returns its slot index, or nullopt if full
+        std::optional<uint32_t> add_symbol(uint16_t stock_locate, std::string_view symbol);
+
+        void publish_top(uint32_t slot, const TopOfBook& top) { slots_[slot].top.write(top); }
+        void publish_depth(uint32_t slot, const BusDepth& depth) { slots_[slot].depth.write(depth); }
+
+        /// Publish `book`'s top-of-book and best DEPTH_LEVELS per side
+        void publish(uint32_t slot, const OrderBook& book);
+
+        uint32_t symbol_count() const { return header_->symbol_count.load(std::memory_order_relaxed); }
+        uint32_t capacity() const { return header_->max_symbols; }
+        const std::string& name() const { return name_; }
+
+    private:
+        MarketDataBusWriter(std::string name, void* base, size_t size);
+
+        std::string name_;
+        void* base_{nullptr};
+        size_t size_{0};
+        BusHeader* header_{nullptr};
+        BusSymbolSlot* slots_{nullptr};
+    };
+
+    /**
+     * @class MarketDataBusReader
+     * @brief Read-only view of a segment created by MarketDataBusWriter.
+     */
+    class MarketDataBusReader {
+    public:
+        /// Map segment `name`; nullopt if it does not exist or fails validation
+        static std::optional<MarketDataBusReader> attach(const std::string& name);
+
+        MarketDataBusReader(MarketDataBusReader&& other) noexcept;
+        MarketDataBusReader& operator=(MarketDataBusReader&&) = delete;
+        MarketDataBusReader(const MarketDataBusReader&) = delete;
+        MarketDataBusReader& operator=(const MarketDataBusReader&) = delete;
+        ~MarketDataBusReader();
+
+        /// Unmap the segment (also done by the destructor)
+        void detach();
+
+        /// Number of symbols published so far (grows while attached)
+        uint32_t symbol_count() const {
+            return header_->symbol_count.load(std::memory_order_acquire);
+        }
+
+        bus::State state() const {
+            return static_cast<bus::State>(header_->state.load(std::memory_order_acquire));
+        }
+
+        /// Slot index for `symbol` (trailing spaces ignored), nullopt if not published
+        std::optional<uint32_t> find(std::string_view symbol) const;
+
+        /// Slot index for `stock_locate`, nullopt if not published
+        std::optional<uint32_t> find(uint16_t stock_locate) const;
+
+        std::string_view symbol(uint32_t slot) const;
+        uint16_t stock_locate(uint32_t slot) const { return slots_[slot].stock_locate; }
+
+        /// Consistent copies; nullopt only if the writer stalled mid-write
+        std::optional<TopOfBook> read_top(uint32_t slot) const { return slots_[slot].top.try_read(); }
+        std::optional<BusDepth> read_depth(uint32_t slot) const { return slots_[slot].depth.try_read(); }
+
+        /// Changes whenever the slot's top-of-book is rewritten (cheap poll)
+        uint64_t top_version(uint32_t slot) const { return slots_[slot].top.version(); }
+
+    private:
+        MarketDataBusReader(void* base, size_t size);
+
+        void* base_{nullptr};
+        size_t size_{0};
+        const BusHeader* header_{nullptr};
+        const BusSymbolSlot* slots_{nullptr};
+    };
+
+} // namespace hft
@@ -3,6 +3,9 @@
 #include "common/types.hpp"
 #include "itch/messages.hpp"
 #include "book/seqlock.hpp"
+#include "book/snapshot.hpp"
+#include "book/book_delta.hpp"
+#include "common/mapped_memory.hpp"
 #include <vector>
 #include <unordered_map>
 #include <iostream>
@@ -24,8 +27,18 @@ namespace hft {
      */
     class OrderBook {
     public:
+        static constexpr size_t DEFAULT_EXPECTED_ORDERS = 1 << 20;
+
         OrderBook(uint16_t stock_locate, const std::string& symbol);
 
+        // Places both price ladders and the order index's bucket array (sized
+        // for `expected_orders`) on dedicated mappings - huge pages, faulted
+        // in and optionally locked here rather than during the open. Set
+        // backing.numa_node to the node of the thread that will process this
+        // book's messages (Topology::current_node() on that thread).
+        OrderBook(uint16_t stock_locate, const std::string& symbol, const BackingOptions& backing,
+                  size_t expected_orders = DEFAULT_EXPECTED_ORDERS);
+
         // --- Message Processing ---
         void add_order(const itch::AddOrder& msg);
         void execute_order(const itch::OrderExecuted& msg);
@@ -34,11 +47,74 @@ namespace hft {
         void delete_order(const itch::OrderDelete& msg);
         void replace_order(const itch::OrderReplace& msg);
 
+        // Dispatches any book-affecting ITCH message to the handler above.
+        // Other message types are ignored.
+        void apply(const itch::ITCHMessage& msg);
+
+        // Same, for the message at MoldUDP64 `sequence` (feed handler, capture
+        // replay): records the sequence BEFORE the book changes, so the deltas
+        // this message publishes carry it. Sequences must increase.
+        void apply(const itch::ITCHMessage& msg, uint64_t sequence);
+
+        // --- Delta Publication ---
+
+        // Publish a BookDelta for every level change into `ring` (nullptr = off).
+        // The book is the ring's single producer.
+        //
+        // Sequence contract: a delta carries last_sequence() at the moment it
+        // is published, so the sequence must be recorded before the change,
+        // never after - apply(msg, sequence), or set_last_sequence() before
+        // calling a handler directly. (Setting it after the handler stamps
+        // every unbatched delta with the previous message's sequence.)
+        void set_delta_ring(BookDeltaRing* ring);
+
+        // Coalesce level changes until end_batch(), e.g. one MoldUDP64 packet.
+        // Outside a batch every message is published on its own.
+        void begin_batch() { in_batch_ = true; }
+        bool end_batch();
+
+        // Ends a batch whose last message had MoldUDP64 `sequence`: records
+        // it, then publishes, so the END_OF_BATCH delta carries it.
+        bool end_batch(uint64_t sequence);
+
+        // Publishes pending level changes. Returns false if the ring filled up;
+        // the remaining levels stay pending and go out (with their latest
+        // state) on the next call.
+        bool publish_deltas();
+
+        // Number of publish attempts cut short by a full ring
+        uint64_t delta_overflows() const { return delta_overflows_; }
+
+        // --- Recovery ---
+
+        // Last MoldUDP64 sequence applied to this book. The feed handler owns
+        // sequencing: it passes each message's sequence to apply(), or records
+        // it here (also for messages that do not touch the book, e.g. a
+        // block that failed to parse). See the sequence contract above.
+        void set_last_sequence(uint64_t sequence) { last_sequence_ = sequence; }
+        uint64_t last_sequence() const { return last_sequence_; }
+
+        // Copies the order map and last sequence into `out`, reusing its
+        // capacity. O(orders) on the calling (book) thread - ~15 ns per
+        // resting order, see SnapshotWriter for checkpoint cadence; levels are
+        // left for the consumer to rebuild (BookSnapshot::build_levels) off
+        // the book thread.
+        void capture_snapshot(BookSnapshot& out) const;
+
+        // Replaces the book state with a checkpoint. Returns false (leaving the
+        // book empty) if the checkpoint belongs to another instrument, holds an
+        // out-of-range price, or its levels disagree with its orders.
+        bool restore_snapshot(const BookSnapshot& snapshot);
+
         // --- Public Accessors ---
 
         // Returns a copy of the top-of-book data using the SeqLock.
         // This is safe to call from any thread.
         TopOfBook get_top_of_book() const;
+
+        // Copies up to `max_levels` non-empty levels on `side`, best first, into
+        // `out`. Returns the number written. Book thread only.
+        size_t get_depth(Side side, PriceLevel* out, size_t max_levels) const;
         
         // Prints the current state of the order book (for debugging).
         void print_book() const;
@@ -51,16 +127,24 @@ namespace hft {
             uint32_t shares;
             Side side;
         };
+
+        // Default-constructed allocators behave like std::allocator
+        using Ladder = std::vector<PriceLevel, MappedAllocator<PriceLevel>>;
+        using OrderIndex = std::unordered_map<uint64_t, Order, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                                              MappedAllocator<std::pair<const uint64_t, Order>>>;
+
+        OrderBook(uint16_t stock_locate, const std::string& symbol,
+                  const MappedAllocator<PriceLevel>& allocator, size_t expected_orders);
         
         // --- Core Data Structures ---
 
         // "Dense Price Ladder" for bids and asks.
         // The index of the vector represents the price.
-        std::vector<PriceLevel> bids_;
-        std::vector<PriceLevel> asks_;
+        Ladder bids_;
+        Ladder asks_;
 
         // Hash map to track individual orders by their reference number.
-        std::unordered_map<uint64_t, Order> orders_;
+        OrderIndex orders_;
 
         // --- Top of Book Management ---
         
@@ -75,8 +159,37 @@ namespace hft {
         uint16_t stock_locate_;
         std::string symbol_;
 
+        // Last MoldUDP64 sequence applied (0 = none)
+        uint64_t last_sequence_{0};
+
+        // --- Delta Publication ---
+        struct DirtyLevel {
+            Price price;
+            Side side;
+        };
+
+        BookDeltaRing* delta_ring_{nullptr};
+        std::vector<DirtyLevel> dirty_levels_;  // Levels changed since last publish (may repeat)
+        bool in_batch_{false};
+        uint64_t delta_overflows_{0};
+
         // --- Private Helper Functions ---
         void update_top_of_book();
+        void clear_orders();
+
+        void mark_dirty(Side side, Price price) {
+            if (delta_ring_) {
+                dirty_levels_.push_back({price, side});
+            }
+        }
+
+        // Called at the end of every mutating handler
+        void on_book_changed() {
+            update_top_of_book();
+            if (!in_batch_) {
+                publish_deltas();
+            }
+        }
     };
 
 } // namespace hft
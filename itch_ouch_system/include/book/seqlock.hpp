@@ -2,6 +2,8 @@
 
 #include <atomic>
 #include <concepts>
+#include <cstdint>
+#include <optional>
 
 namespace hft {
 
@@ -18,11 +20,18 @@ namespace hft {
      * 2. The data structure `T` is small and cheap to copy.
      * 3. There is only ONE writer thread.
      *
+     * The layout is address-free (a lock-free atomic counter followed by the
+     * data), so a SeqLock may live in memory shared between processes; it must
+     * be constructed in place once by the writer (see MarketDataBus).
+     *
      * @tparam T The type of the data to be protected. Must be trivially copyable.
      */
     template <std::copyable T>
     class SeqLock {
     public:
+        static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                      "SeqLock must not depend on a process-local lock table");
+
         SeqLock() : sequence_(0) {}
 
         /**
@@ -35,23 +44,31 @@ namespace hft {
          */
         T read() const {
             T data;
-            uint32_t seq1, seq2 = 0;
-            do {
-                seq1 = sequence_.load(std::memory_order_acquire);
-                while (seq1 & 1) { // Wait for writer to finish
-                    seq1 = sequence_.load(std::memory_order_acquire);
-                }
-
-                // Make a copy of the data.
-                data = data_;
-
-                // Check if the sequence number has changed. If it has, the data is
-                // inconsistent, so we must retry.
-                seq2 = sequence_.load(std::memory_order_acquire);
+            while (!try_read_once(data)) {
+            }
+            return data;
+        }
 
-            } while (seq1 != seq2);
+        /**
+         * @brief Bounded read for readers that must not hang on a stalled writer
+         * (e.g. a writer process that died mid-write).
+         *
+         * @param max_attempts Number of read attempts before giving up.
+         * @return A consistent copy, or std::nullopt if every attempt overlapped a write.
+         */
+        std::optional<T> try_read(uint32_t max_attempts = 1024) const {
+            T data;
+            for (uint32_t i = 0; i < max_attempts; ++i) {
+                if (try_read_once(data)) {
+                    return data;
+                }
+            }
+            return std::nullopt;
+        }
 
-            return data;
+        /// Number of completed writes (sequence / 2)
+        uint64_t version() const {
+            return sequence_.load(std::memory_order_acquire) >> 1;
         }
 
         /**
@@ -65,7 +82,10 @@ namespace hft {
          */
         void write(const T& new_data) noexcept {
             // Increment sequence to an odd number, signaling a write is in progress.
-            sequence_.fetch_add(1, std::memory_order_release);
+            // The release fence keeps the data writes below from becoming
+            // visible before the odd sequence.
+            sequence_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
 
             // Perform the write.
             data_ = new_data;
@@ -76,6 +96,22 @@ namespace hft {
         }
 
     private:
+        // One read attempt: false if a write was in progress or overlapped the copy.
+        bool try_read_once(T& out) const {
+            const uint64_t seq1 = sequence_.load(std::memory_order_acquire);
+            if (seq1 & 1) {
+                return false;
+            }
+
+            out = data_;
+
+            // The acquire fence keeps the copy above from being reordered
+            // after the second sequence load.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t seq2 = sequence_.load(std::memory_order_relaxed);
+            return seq1 == seq2;
+        }
+
         // The sequence counter. Even = stable, Odd = write in progress.
         alignas(64) std::atomic<uint64_t> sequence_;
         
@@ -0,0 +1,99 @@
+#pragma once
+// include/book/snapshot.hpp
+//
+// Binary order-book checkpoints for mid-session recovery
+//
+// A checkpoint holds everything needed to resume a book without replaying the
+// session from message 1:
+// - Every resting order (reference, price, shares, side)
+// - The aggregated price levels (so L2 can be read without rebuilding)
+// - The last MoldUDP64 sequence applied to the book
+//
+// File layout (host byte order - checkpoints are local, same-machine files):
+//   SnapshotFileHeader (64 bytes)
+//   SnapshotLevel  x level_count   (bids best-first, then asks best-first)
+//   SnapshotOrder  x order_count
+//
+// The header carries an FNV-1a checksum over the level and order sections so
+// a torn or truncated write is rejected on load instead of silently producing
+// a wrong book. Files are written to "<path>.tmp", fdatasync'ed, renamed into
+// place and the directory fsync'ed, so the replacement is atomic across power
+// loss too, not just process crashes.
+
+#include "common/types.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hft {
+
+    /// One resting order as stored in a checkpoint
+    struct SnapshotOrder {
+        uint64_t order_reference{0};
+        Price price{0};
+        uint32_t shares{0};
+        Side side{Side::BUY};
+        uint8_t reserved[3]{};  // Explicit padding: keeps file bytes deterministic
+    };
+    static_assert(sizeof(SnapshotOrder) == 24, "SnapshotOrder layout is part of the file format");
+
+    /// One non-empty price level as stored in a checkpoint
+    struct SnapshotLevel {
+        Price price{0};
+        Quantity quantity{0};
+        uint32_t order_count{0};
+        Side side{Side::BUY};
+        uint8_t reserved[7]{};
+    };
+    static_assert(sizeof(SnapshotLevel) == 24, "SnapshotLevel layout is part of the file format");
+
+    /// In-memory checkpoint of one OrderBook
+    ///
+    /// Captured on the book thread by OrderBook::capture_snapshot() (orders only,
+    /// O(orders) copy into reused vectors - the one part of a checkpoint that
+    /// stalls the book), completed with build_levels() and written by a
+    /// background thread (see SnapshotWriter).
+    struct BookSnapshot {
+        uint16_t stock_locate{0};
+        std::array<char, 8> symbol{};  // Space-padded, as on the ITCH wire
+        uint64_t last_sequence{0};     // Last MoldUDP64 sequence applied to the book
+        std::vector<SnapshotLevel> levels;
+        std::vector<SnapshotOrder> orders;
+
+        /// Aggregate `orders` into `levels` (bids descending, asks ascending)
+        void build_levels();
+
+        /// Clear contents but keep vector capacity for reuse
+        void clear();
+    };
+
+    namespace snapshot {
+        constexpr std::array<char, 8> MAGIC = {'H', 'F', 'T', 'B', 'O', 'O', 'K', '\0'};
+        constexpr uint32_t VERSION = 1;
+    } // namespace snapshot
+
+    /// Fixed-size file header
+    struct SnapshotFileHeader {
+        std::array<char, 8> magic{};
+        uint32_t version{0};
+        uint16_t stock_locate{0};
+        uint16_t reserved{0};
+        std::array<char, 8> symbol{};
+        uint64_t last_sequence{0};
+        uint64_t level_count{0};
+        uint64_t order_count{0};
+        uint64_t checksum{0};      // FNV-1a over level + order sections
+        uint64_t reserved2{0};
+    };
+    static_assert(sizeof(SnapshotFileHeader) == 64, "SnapshotFileHeader layout is part of the file format");
+
+    /// Write a checkpoint atomically and durably (temp file, fdatasync, rename,
+    /// directory fsync). Two syncs per call: run it off the book thread.
+    /// @return Number of bytes written, or error
+    Result<size_t> save_snapshot(const BookSnapshot& snapshot, const std::string& path);
+
+    /// Read and validate a checkpoint (magic, version, sizes, checksum)
+    Result<BookSnapshot> load_snapshot(const std::string& path);
+
+} // namespace hft
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace hft {
+
+    /**
+     * @class MonotonicArena
+     * @brief Bump-pointer scratch memory that is rewound, not freed.
+     *
+     * Per-packet work (the MoldUDP64Packet block vector, ParseResult error
+     * strings, temporary containers) allocates a few small blocks and drops
+     * them all together. The arena serves those from one pre-allocated buffer
+     * by bumping a pointer, ignores individual deallocations, and reset()
+     * rewinds the pointer once the packet (or batch) is done: no global-heap
+     * traffic and no per-object free.
+     *
+     * Implements std::pmr::memory_resource, so any std::pmr container or
+     * string can use it. Callers that know the concrete type can call
+     * allocate_bytes() directly, which is inlined instead of going through
+     * the virtual do_allocate().
+     *
+     * Unlike std::pmr::monotonic_buffer_resource, overflow blocks are
+     * returned to the upstream resource on every reset() instead of being
+     * kept and grown geometrically, and overflow_count() / high_water() show
+     * whether the buffer is sized right. A correctly sized arena never
+     * touches upstream.
+     *
+     * Not thread-safe: one arena per thread (e.g. per receive thread).
+     *
+     * Usage:
+     * @code
+     * MonotonicArena arena;                       // 64 KiB, allocated once
+     *
+     * while (auto len = socket.receive(buffer)) {
+     *     auto packet = network::MoldUDP64Packet::parse(buffer, len, &arena);
+     *     for (const auto& block : packet->messages) {
+     *         auto result = itch::parse_message(block.data, block.length, &arena);
+     *         // ...
+     *     }
+     *     arena.reset();                          // Everything above is gone
+     * }
+     * @endcode
+     */
+    class MonotonicArena final : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+        static constexpr size_t BUFFER_ALIGNMENT = 64;
+
+        /// Allocates the `capacity`-byte buffer up front.
+        /// @param upstream Serves requests that do not fit in the buffer
+        explicit MonotonicArena(size_t capacity = DEFAULT_CAPACITY,
+                                std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+            : buffer_(static_cast<std::byte*>(::operator new(capacity, std::align_val_t{BUFFER_ALIGNMENT}))),
+              capacity_(capacity),
+              upstream_(upstream) {}
+
+        ~MonotonicArena() override {
+            release_overflow();
+            ::operator delete(buffer_, std::align_val_t{BUFFER_ALIGNMENT});
+        }
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        /// Non-virtual fast path: bump within the buffer, else overflow upstream
+        void* allocate_bytes(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(buffer_);
+            const uintptr_t aligned = (base + used_ + alignment - 1) & ~(alignment - 1);
+            const size_t offset = static_cast<size_t>(aligned - base);
+            if (offset <= capacity_ && bytes <= capacity_ - offset) [[likely]] {
+                const size_t end = offset + bytes;
+                used_ = end;
+                high_water_ = end > high_water_ ? end : high_water_;
+                return reinterpret_cast<void*>(aligned);
+            }
+            return allocate_overflow(bytes, alignment);
+        }
+
+        /// Rewind to empty. Everything allocated since the last reset() is invalid.
+        void reset() noexcept {
+            used_ = 0;
+            release_overflow();
+        }
+
+        /// Bytes of the buffer in use since the last reset()
+        size_t used() const noexcept { return used_; }
+        size_t capacity() const noexcept { return capacity_; }
+
+        /// Largest used() seen; size the buffer from this
+        size_t high_water() const noexcept { return high_water_; }
+
+        /// Allocations that did not fit and went to upstream (never reset)
+        size_t overflow_count() const noexcept { return overflow_count_; }
+
+    private:
+        /// Header in front of each upstream block, chaining them for reset()
+        struct Overflow {
+            Overflow* next;
+            size_t bytes;
+            size_t alignment;
+        };
+
+        static constexpr size_t header_size(size_t alignment) noexcept {
+            return (sizeof(Overflow) + alignment - 1) & ~(alignment - 1);
+        }
+
+        [[gnu::noinline]] void* allocate_overflow(size_t bytes, size_t alignment) {
+            if (alignment < alignof(Overflow)) {
+                alignment = alignof(Overflow);
+            }
+            const size_t header = header_size(alignment);
+            auto* raw = static_cast<std::byte*>(upstream_->allocate(header + bytes, alignment));
+            // Header sits right before the returned block
+            auto* block = ::new (raw + header - sizeof(Overflow)) Overflow{overflow_, header + bytes, alignment};
+            overflow_ = block;
+            ++overflow_count_;
+            return raw + header;
+        }
+
+        void release_overflow() noexcept {
+            while (overflow_ != nullptr) {
+                Overflow* block = overflow_;
+                overflow_ = block->next;
+                auto* raw = reinterpret_cast<std::byte*>(block + 1) - header_size(block->alignment);
+                upstream_->deallocate(raw, block->bytes, block->alignment);
+            }
+        }
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            return allocate_bytes(bytes, alignment);
+        }
+
+        void do_deallocate(void*, size_t, size_t) override {
+            // Freed in bulk by reset()
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+        std::byte* buffer_;
+        size_t used_{0};
+        size_t capacity_;
+        size_t high_water_{0};
+
+        Overflow* overflow_{nullptr};
+        size_t overflow_count_{0};
+        std::pmr::memory_resource* upstream_;
+    };
+
+} // namespace hft
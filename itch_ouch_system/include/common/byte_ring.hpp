@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace hft {
+
+    /**
+     * @class ByteRing
+     * @brief Bounded single-producer, single-consumer ring of variable-length byte records.
+     *
+     * Carries raw ITCH messages (12-50 bytes) without padding every record up
+     * to the largest message type, and without handing the consumer pointers
+     * into a MoldUDP64 receive buffer that may be reused.
+     *
+     * Record layout (all records start on an 8-byte boundary):
+     *   [uint32_t length][payload: length bytes][pad to 8]
+     *
+     * A record never straddles the end of the buffer. If it does not fit in
+     * the bytes left before the end, the producer writes a padding record
+     * (length == PADDING) over that tail and starts the record at offset 0;
+     * the consumer skips padding records transparently.
+     *
+     * Both sides use free-running 64-bit byte offsets and cache the other
+     * side's offset (same scheme as hft::core::RingBuffer), refreshing it only when the
+     * ring looks full/empty.
+     *
+     * Usage:
+     * @code
+     * ByteRing<1 << 16> ring;
+     *
+     * // Producer: copy in, or claim and write in place
+     * ring.try_push(msg_bytes, msg_len);
+     * auto slot = ring.claim(max_len);
+     * size_t n = encode(slot.data());
+     * ring.commit(n);
+     *
+     * // Consumer: read in place, then release
+     * auto record = ring.peek();
+     * if (!record.empty()) {
+     *     handle(record.data(), record.size());
+     *     ring.pop();
+     * }
+     * @endcode
+     *
+     * @tparam CapacityBytes Buffer size in bytes. Must be a power of 2.
+     */
+    template <size_t CapacityBytes>
+    class ByteRing {
+        static_assert(CapacityBytes >= 64 && (CapacityBytes & (CapacityBytes - 1)) == 0,
+                      "CapacityBytes must be a power of 2 (>= 64)");
+
+    public:
+        static constexpr size_t ALIGNMENT = 8;
+        static constexpr size_t HEADER_SIZE = sizeof(uint32_t);
+        static constexpr uint32_t PADDING = 0xFFFFFFFFu;
+        static constexpr size_t INDEX_MASK = CapacityBytes - 1;
+
+        /// Largest payload accepted; keeps a record placeable after any padding
+        static constexpr size_t MAX_RECORD_SIZE = CapacityBytes / 2 - HEADER_SIZE;
+
+        ByteRing() = default;
+        ByteRing(const ByteRing&) = delete;
+        ByteRing& operator=(const ByteRing&) = delete;
+
+        /// Bytes a record of `length` payload bytes occupies in the ring
+        static constexpr size_t record_size(size_t length) noexcept {
+            return (HEADER_SIZE + length + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        }
+
+        // ====================================================================
+        // PRODUCER
+        // ====================================================================
+
+        /// Reserve space for a record of 1..`max_length` bytes
+        /// @return Writable payload bytes, or an empty span if full / too large.
+        ///         Nothing is visible to the consumer until commit().
+        [[nodiscard]] std::span<uint8_t> claim(size_t max_length) noexcept {
+            if (max_length == 0 || max_length > MAX_RECORD_SIZE) {
+                return {};
+            }
+
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            const size_t total = record_size(max_length);
+            const size_t until_end = CapacityBytes - (head & INDEX_MASK);
+            const size_t padding = (until_end < total) ? until_end : 0;
+
+            if (!has_space(head, padding + total)) {
+                return {};
+            }
+
+            if (padding) {
+                write_header(head, PADDING);
+                head += padding;
+            }
+
+            claimed_head_ = head;
+            return std::span<uint8_t>(&buffer_[(head & INDEX_MASK) + HEADER_SIZE], max_length);
+        }
+
+        /// Publish the last claim() with its actual `length` (1..claimed size)
+        void commit(size_t length) noexcept {
+            write_header(claimed_head_, static_cast<uint32_t>(length));
+            head_.store(claimed_head_ + record_size(length), std::memory_order_release);
+        }
+
+        /// Copy `length` bytes in as one record; false if full, empty or too large
+        [[nodiscard]] bool try_push(const void* data, size_t length) noexcept {
+            auto slot = claim(length);
+            if (slot.empty()) {
+                return false;
+            }
+            std::memcpy(slot.data(), data, length);
+            commit(length);
+            return true;
+        }
+
+        // ====================================================================
+        // CONSUMER
+        // ====================================================================
+
+        /// Next record, read in place; empty span if the ring is empty.
+        /// Valid until pop().
+        [[nodiscard]] std::span<const uint8_t> peek() noexcept {
+            uint64_t tail = tail_.load(std::memory_order_relaxed);
+            while (true) {
+                if (tail == cached_head_) {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                    if (tail == cached_head_) {
+                        return {};
+                    }
+                }
+
+                const uint32_t length = read_header(tail);
+                if (length != PADDING) {
+                    peeked_size_ = record_size(length);
+                    return std::span<const uint8_t>(&buffer_[(tail & INDEX_MASK) + HEADER_SIZE], length);
+                }
+
+                // Skip the padding record and hand its space back
+                tail += CapacityBytes - (tail & INDEX_MASK);
+                tail_.store(tail, std::memory_order_release);
+            }
+        }
+
+        /// Release the record returned by the last peek()
+        void pop() noexcept {
+            const uint64_t tail = tail_.load(std::memory_order_relaxed);
+            tail_.store(tail + peeked_size_, std::memory_order_release);
+        }
+
+        // ====================================================================
+        // MONITORING
+        // ====================================================================
+
+        /// Bytes in use, including headers and padding (approximate across threads)
+        size_t bytes_used() const noexcept {
+            return static_cast<size_t>(head_.load(std::memory_order_acquire) -
+                                       tail_.load(std::memory_order_acquire));
+        }
+
+        bool empty() const noexcept { return bytes_used() == 0; }
+
+        static constexpr size_t capacity() noexcept { return CapacityBytes; }
+
+    private:
+        bool has_space(uint64_t head, size_t needed) noexcept {
+            if (CapacityBytes - (head - cached_tail_) < needed) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (CapacityBytes - (head - cached_tail_) < needed) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void write_header(uint64_t position, uint32_t value) noexcept {
+            std::memcpy(&buffer_[position & INDEX_MASK], &value, sizeof(value));
+        }
+
+        uint32_t read_header(uint64_t position) const noexcept {
+            uint32_t value;
+            std::memcpy(&value, &buffer_[position & INDEX_MASK], sizeof(value));
+            return value;
+        }
+
+        // Producer cache line
+        alignas(64) std::atomic<uint64_t> head_{0};
+        uint64_t cached_tail_{0};
+        uint64_t claimed_head_{0};
+
+        // Consumer cache line
+        alignas(64) std::atomic<uint64_t> tail_{0};
+        uint64_t cached_head_{0};
+        size_t peeked_size_{0};
+
+        alignas(64) std::array<uint8_t, CapacityBytes> buffer_{};
+    };
+
+} // namespace hft
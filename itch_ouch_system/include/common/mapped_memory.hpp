@@ -0,0 +1,79 @@
+#pragma once
+
+#include "backing_memory.hpp"  // 03_memory_pool: MappedRegion, BackingOptions
+#include <cstddef>
+#include <memory>
+
+namespace hft {
+
+    // One implementation of huge-page / pre-fault / mlock / NUMA backing,
+    // shared with the memory pool module
+    using memory::ANY_NUMA_NODE;
+    using memory::BackingOptions;
+    using memory::HugePages;
+    using memory::MappedRegion;
+
+    /**
+     * @class MappedAllocator
+     * @brief STL allocator that gives large allocations their own MappedRegion.
+     *
+     * Allocations of at least MIN_MAPPED_BYTES (a price ladder, a reserved
+     * hash-bucket array) get a dedicated huge-page / pre-faulted / locked
+     * mapping; smaller ones (hash-map nodes) go to std::allocator, where a
+     * mapping per node would waste a page each. The choice depends only on
+     * the size, so deallocate() makes the same decision as allocate().
+     *
+     * A default-constructed allocator never maps: containers using it behave
+     * exactly as with std::allocator.
+     */
+    template <typename T>
+    class MappedAllocator {
+    public:
+        using value_type = T;
+
+        static constexpr size_t MIN_MAPPED_BYTES = MappedRegion::HUGE_PAGE_SIZE;
+
+        MappedAllocator() noexcept = default;
+        explicit MappedAllocator(BackingOptions options) noexcept
+            : options_(options), mapped_(true) {}
+
+        template <typename U>
+        MappedAllocator(const MappedAllocator<U>& other) noexcept
+            : options_(other.options()), mapped_(other.mapped()) {}
+
+        T* allocate(size_t n) {
+            const size_t bytes = n * sizeof(T);
+            if (!uses_mapping(bytes)) {
+                return std::allocator<T>().allocate(n);
+            }
+            static_assert(alignof(T) <= MappedRegion::PAGE_SIZE, "Type alignment exceeds page size");
+            return static_cast<T*>(MappedRegion(bytes, options_).detach());
+        }
+
+        void deallocate(T* p, size_t n) noexcept {
+            const size_t bytes = n * sizeof(T);
+            if (!uses_mapping(bytes)) {
+                std::allocator<T>().deallocate(p, n);
+                return;
+            }
+            MappedRegion::unmap(p, bytes);
+        }
+
+        BackingOptions options() const noexcept { return options_; }
+        bool mapped() const noexcept { return mapped_; }
+
+        template <typename U>
+        bool operator==(const MappedAllocator<U>& other) const noexcept {
+            return mapped_ == other.mapped();
+        }
+
+    private:
+        bool uses_mapping(size_t bytes) const noexcept {
+            return mapped_ && bytes >= MIN_MAPPED_BYTES;
+        }
+
+        BackingOptions options_{};
+        bool mapped_{false};
+    };
+
+} // namespace hft
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "common/mapped_memory.hpp"
+#include "numa_topology.hpp"  // 03_memory_pool: detection, CPU -> node lookup, pinning
+
+namespace hft {
+
+    // One implementation of NUMA topology, shared with the ring buffer
+    // module's make_on_node() placement
+    using memory::Topology;
+
+} // namespace hft
@@ -9,6 +9,9 @@
 #include <string_view>
 #include <chrono>
 #include <array>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
 
 namespace hft {
 
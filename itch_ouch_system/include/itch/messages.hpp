@@ -17,6 +17,8 @@
 #include <array>
 #include <cstring>
 #include <string_view>
+#include <string>
+#include <memory_resource>
 #include <cstdio>
 #include <bit>
 
@@ -1285,28 +1287,33 @@ namespace hft::itch {
     >;
 
     /// Parse result with error information
+    ///
+    /// `error_detail` is a std::pmr::string so a per-packet arena can back it
+    /// (see parse_message(buffer, length, resource)); it stays empty on success.
     struct ParseResult {
         std::optional<ITCHMessage> message;
         ErrorCode error_code{ ErrorCode::SUCCESS };
-        std::string error_detail;
+        std::pmr::string error_detail;
 
         bool is_success() const { return message.has_value(); }
 
         static ParseResult ok(ITCHMessage msg) {
-            return { std::move(msg), ErrorCode::SUCCESS, "" };
+            return { std::move(msg), ErrorCode::SUCCESS, {} };
         }
 
-        static ParseResult error(ErrorCode code, std::string detail) {
-            return { std::nullopt, code, std::move(detail) };
+        static ParseResult error(ErrorCode code, std::string_view detail,
+                                 std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+            return { std::nullopt, code, std::pmr::string(detail, resource) };
         }
     };
 
-    /// Parse ITCH message from buffer
-    inline ParseResult parse_message(const uint8_t* buffer, size_t length) {
+    /// Parse ITCH message from buffer; error details are allocated from `resource`
+    inline ParseResult parse_message(const uint8_t* buffer, size_t length,
+                                     std::pmr::memory_resource* resource) {
         // Validate minimum size
         if (length < 1) {
             return ParseResult::error(ErrorCode::PARSE_INVALID_SIZE,
-                "Message too short (< 1 byte)");
+                "Message too short (< 1 byte)", resource);
         }
 
         // Extract message type
@@ -1380,14 +1387,23 @@ namespace hft::itch {
         case MessageType::DLCR:
             if (auto msg = DLCR::parse(buffer, length)) return ParseResult::ok(ITCHMessage{*msg});
             break;
-        default:
-            return ParseResult::error(ErrorCode::PARSE_INVALID_TYPE,
-                "Unknown message type: " + std::to_string(buffer[0]));
+        default: {
+            std::pmr::string detail("Unknown message type: ", resource);
+            detail += std::to_string(buffer[0]);  // <= 3 chars: no allocation
+            return { std::nullopt, ErrorCode::PARSE_INVALID_TYPE, std::move(detail) };
+        }
         }
         
         // If we reach here, the message type was recognized but parsing failed
-        return ParseResult::error(ErrorCode::PARSE_INVALID_SIZE,
-            "Message type " + std::to_string(buffer[0]) + " failed to parse (invalid size or format)");
+        std::pmr::string detail("Message type ", resource);
+        detail += std::to_string(buffer[0]);
+        detail += " failed to parse (invalid size or format)";
+        return { std::nullopt, ErrorCode::PARSE_INVALID_SIZE, std::move(detail) };
+    }
+
+    /// Parse ITCH message from buffer (error details on the global heap)
+    inline ParseResult parse_message(const uint8_t* buffer, size_t length) {
+        return parse_message(buffer, length, std::pmr::get_default_resource());
     }
 
     // ============================================================================
@@ -0,0 +1,87 @@
+#pragma once
+// include/network/capture_file.hpp
+//
+// Raw MoldUDP64 datagram capture file
+//
+// Records every datagram exactly as received so a restarted process can
+// replay the tail of the session after restoring a book checkpoint.
+//
+// Record layout (same framing as MoldUDP64 message blocks):
+// - Length: 2 bytes (big-endian uint16_t)
+// - Datagram: `length` bytes (MoldUDP64 header + message blocks)
+//
+// The file has no header so it can be appended to across restarts; a
+// truncated final record (crash mid-write) is treated as end of file.
+
+#include "network/moldudp64.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+
+namespace hft::network {
+
+    /// Appends raw datagrams to a capture file
+    class CaptureWriter {
+    public:
+        explicit CaptureWriter(const std::string& path)
+            : out_(path, std::ios::binary | std::ios::app) {}
+
+        [[nodiscard]] bool is_open() const { return out_.is_open(); }
+
+        /// Append one datagram; returns false on oversize datagram or I/O error
+        bool write(const uint8_t* datagram, size_t length) {
+            if (length > protocol::MAX_PACKET_SIZE) {
+                return false;
+            }
+            const uint8_t prefix[2] = {
+                static_cast<uint8_t>(length >> 8),
+                static_cast<uint8_t>(length & 0xFF)
+            };
+            out_.write(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+            out_.write(reinterpret_cast<const char*>(datagram), static_cast<std::streamsize>(length));
+            return static_cast<bool>(out_);
+        }
+
+        void flush() { out_.flush(); }
+
+    private:
+        std::ofstream out_;
+    };
+
+    /// Reads datagrams back in capture order
+    ///
+    /// The returned span points into an internal buffer and is valid until the
+    /// next call to next().
+    class CaptureReader {
+    public:
+        explicit CaptureReader(const std::string& path)
+            : in_(path, std::ios::binary) {}
+
+        [[nodiscard]] bool is_open() const { return in_.is_open(); }
+
+        /// Read the next datagram; returns false at end of file or on a
+        /// truncated/oversize record
+        [[nodiscard]] bool next(std::span<const uint8_t>& datagram) {
+            uint8_t prefix[2];
+            if (!in_.read(reinterpret_cast<char*>(prefix), sizeof(prefix))) {
+                return false;
+            }
+            const size_t length = (static_cast<size_t>(prefix[0]) << 8) | prefix[1];
+            if (length > buffer_.size()) {
+                return false;
+            }
+            if (!in_.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(length))) {
+                return false;
+            }
+            datagram = std::span<const uint8_t>(buffer_.data(), length);
+            return true;
+        }
+
+    private:
+        std::ifstream in_;
+        std::array<uint8_t, protocol::MAX_PACKET_SIZE> buffer_{};
+    };
+
+} // namespace hft::network
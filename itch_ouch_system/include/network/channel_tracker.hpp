@@ -0,0 +1,167 @@
+#pragma once
+// include/network/channel_tracker.hpp
+//
+// Multi-channel MoldUDP64 sequence tracking for partitioned feeds
+//
+// NASDAQ (and most venues) split a feed across several multicast groups, each
+// an independent MoldUDP64 stream with its own session ID and sequence space.
+// A single receive thread typically drains all of them (epoll / busy-poll over
+// tens of sockets), so per-channel state must be cheap to reach by index.
+//
+// Design:
+// - Channels are identified by a dense index [0, MaxChannels) assigned at
+//   startup (e.g. position in the multicast group config). No hashing, no map.
+// - Hot state (one SequenceTracker per channel, < 1 cache line) lives in one flat
+//   array; monitoring counters live in a separate array so they don't dilute
+//   the hot cache lines.
+// - Single-threaded: owned by the receive thread, like SequenceTracker.
+
+#include "network/moldudp64.hpp"
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace hft::network {
+
+    /// Per-channel monitoring counters (not needed for gap detection itself)
+    struct ChannelStats {
+        uint64_t packets{0};           // Packets processed on this channel
+        uint64_t gaps{0};              // Gap events detected
+        uint64_t messages_missed{0};   // Sum of gap_count over all gaps
+        uint64_t out_of_order{0};      // Duplicate / late packets
+        uint64_t session_changes{0};   // Session rollovers observed
+        uint64_t session_rejects{0};   // Packets from a non-expected session
+    };
+
+    /// Sequence tracker for up to MaxChannels independent MoldUDP64 streams
+    ///
+    /// Each channel behaves exactly like a standalone SequenceTracker (same
+    /// heartbeat, end-of-session and rollover semantics); this class only adds
+    /// flat storage, per-channel counters and feed-wide queries.
+    ///
+    /// Example usage:
+    /// @code
+    /// MultiChannelSequenceTracker<32> tracker;
+    ///
+    /// // Receive loop: channel index comes from which socket fired
+    /// if (auto view = MoldUDP64PacketView::parse(buf, len)) {
+    ///     auto gap = tracker.process_packet(channel, *view);
+    ///     if (gap.has_gap) request_retransmit(channel, gap.gap_start, gap.gap_count);
+    /// }
+    /// @endcode
+    ///
+    /// @tparam MaxChannels Number of channel slots (fixed at compile time)
+    template<size_t MaxChannels>
+    class MultiChannelSequenceTracker {
+    public:
+        static_assert(MaxChannels > 0, "Need at least one channel");
+
+        /// Process a packet received on `channel` and detect gaps
+        ///
+        /// @param channel Dense channel index, must be < MaxChannels
+        /// @param packet Any packet type SequenceTracker accepts (header, packet, view)
+        /// @return GapInfo for this channel only (see SequenceTracker::process_packet)
+        template<typename Packet>
+        [[nodiscard]] GapInfo process_packet(size_t channel, const Packet& packet) {
+            assert(channel < MaxChannels && "channel index out of range");
+
+            GapInfo info = trackers_[channel].process_packet(packet);
+
+            ChannelStats& stats = stats_[channel];
+            ++stats.packets;
+            if (info.has_gap) {
+                ++stats.gaps;
+                stats.messages_missed += info.gap_count;
+            }
+            if (info.out_of_order) {
+                ++stats.out_of_order;
+            }
+            if (info.session_changed) {
+                ++stats.session_changes;
+            }
+            if (info.session_rejected) {
+                ++stats.session_rejects;
+            }
+            return info;
+        }
+
+        /// Pin a channel to a session ID (see SequenceTracker::set_expected_session)
+        [[nodiscard]] bool set_expected_session(size_t channel, std::string_view session) {
+            assert(channel < MaxChannels && "channel index out of range");
+            return trackers_[channel].set_expected_session(session);
+        }
+
+        /// Read-only access to a channel's tracker (expected sequence, session, EOS)
+        [[nodiscard]] const SequenceTracker& channel(size_t channel) const {
+            assert(channel < MaxChannels && "channel index out of range");
+            return trackers_[channel];
+        }
+
+        /// Monitoring counters for a channel
+        [[nodiscard]] const ChannelStats& stats(size_t channel) const {
+            assert(channel < MaxChannels && "channel index out of range");
+            return stats_[channel];
+        }
+
+        /// Next expected sequence on a channel
+        [[nodiscard]] uint64_t expected_sequence(size_t channel) const {
+            return this->channel(channel).expected_sequence();
+        }
+
+        /// Channels that have seen at least one packet
+        [[nodiscard]] std::bitset<MaxChannels> active_channels() const {
+            std::bitset<MaxChannels> mask;
+            for (size_t i = 0; i < MaxChannels; ++i) {
+                mask[i] = trackers_[i].is_initialized();
+            }
+            return mask;
+        }
+
+        /// Channels that have received end-of-session
+        [[nodiscard]] std::bitset<MaxChannels> ended_channels() const {
+            std::bitset<MaxChannels> mask;
+            for (size_t i = 0; i < MaxChannels; ++i) {
+                mask[i] = trackers_[i].is_end_of_session();
+            }
+            return mask;
+        }
+
+        /// True once every active channel has received end-of-session
+        ///
+        /// Used to decide when the whole feed is done (stop the receive loop,
+        /// flush books) rather than reacting to the first channel that closes.
+        [[nodiscard]] bool all_ended() const {
+            auto active = active_channels();
+            return active.any() && (ended_channels() == active);
+        }
+
+        /// Reset one channel (e.g. after rejoining its multicast group)
+        void reset(size_t channel) {
+            assert(channel < MaxChannels && "channel index out of range");
+            trackers_[channel].reset();
+            stats_[channel] = ChannelStats{};
+        }
+
+        /// Reset every channel
+        void reset() {
+            for (size_t i = 0; i < MaxChannels; ++i) {
+                reset(i);
+            }
+        }
+
+        [[nodiscard]] static constexpr size_t capacity() {
+            return MaxChannels;
+        }
+
+    private:
+        // Hot: touched on every packet
+        std::array<SequenceTracker, MaxChannels> trackers_{};
+
+        // Warm: counters, kept apart from the tracker array
+        std::array<ChannelStats, MaxChannels> stats_{};
+    };
+
+} // namespace hft::network
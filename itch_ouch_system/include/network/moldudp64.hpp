@@ -24,14 +24,16 @@
 // ✅ End-of-session support
 // ✅ Sequence tracking and gap detection
 // ✅ Zero-copy message extraction
+// ✅ Zero-allocation packet view (MoldUDP64PacketView / MoldUDP64InlinePacket)
 // ❌ Upstream request packets (retransmission requests) - TODO Phase 2b
 // ❌ Out-of-order packet buffering - TODO Phase 2b
-// ❌ Session validation (verify session ID matches expected) - TODO Phase 2b
+// ✅ Session validation (verify session ID matches expected)
 //
 // Design Philosophy:
 // - Zero-copy message extraction where possible
 // - Explicit sequence gap detection (including heartbeats)
-// - No heap allocations in hot path (except vector reserve)
+// - No heap allocations in hot path (MoldUDP64Packet's vector is the legacy
+//   convenience path; use MoldUDP64PacketView or MoldUDP64InlinePacket)
 // - Fail-fast validation (length checks, bounds checks)
 
 #include "common/types.hpp"
@@ -39,8 +41,11 @@
 #include <cstring>
 #include <array>
 #include <vector>
+#include <memory_resource>
 #include <optional>
 #include <string_view>
+#include <iterator>
+#include <cstddef>
 
 namespace hft::network {
 
@@ -77,6 +82,49 @@ namespace hft::network {
             return std::string_view(raw.data(), len);
         }
 
+        /// 10-byte session ID packed into two integers (8 + 2 bytes)
+        ///
+        /// Lets SequenceTracker compare sessions with two loads and one branch
+        /// instead of trimming and comparing string_views on every packet. Raw
+        /// bytes are compared as-is; callers fall back to normalize_session()
+        /// on mismatch so space- vs NUL-padded IDs still match.
+        struct SessionFingerprint {
+            uint64_t head{0};  // Bytes 0-7
+            uint16_t tail{0};  // Bytes 8-9
+
+            static SessionFingerprint from(const std::array<char, protocol::SESSION_ID_LENGTH>& raw) {
+                SessionFingerprint fp;
+                std::memcpy(&fp.head, raw.data(), sizeof(fp.head));
+                std::memcpy(&fp.tail, raw.data() + sizeof(fp.head), sizeof(fp.tail));
+                return fp;
+            }
+
+            bool operator==(const SessionFingerprint& other) const {
+                // Single branch: OR of both XORs is zero only if all 10 bytes match
+                return ((head ^ other.head) | static_cast<uint64_t>(tail ^ other.tail)) == 0;
+            }
+        };
+        static_assert(sizeof(uint64_t) + sizeof(uint16_t) == protocol::SESSION_ID_LENGTH,
+                      "SessionFingerprint must cover exactly the session ID");
+
+        /// True if a session ID off the wire denotes the known session
+        /// Fast path compares fingerprints; slow path tolerates padding differences.
+        /// On a slow-path match `known_fp` adopts the wire form, so a feed that
+        /// pads differently from `known` pays the trim once, not per packet.
+        inline bool same_session(const SessionFingerprint& wire_fp,
+                                 const std::array<char, protocol::SESSION_ID_LENGTH>& wire,
+                                 SessionFingerprint& known_fp,
+                                 const std::array<char, protocol::SESSION_ID_LENGTH>& known) {
+            if (wire_fp == known_fp) {
+                return true;
+            }
+            if (normalize_session(wire) != normalize_session(known)) {
+                return false;
+            }
+            known_fp = wire_fp;
+            return true;
+        }
+
         // Detect host endianness at compile time
         #if defined(_MSC_VER)
             // MSVC only ships little-endian targets in practice
@@ -178,6 +226,30 @@ namespace hft::network {
             return detail::normalize_session(session);
         }
 
+        /// Check if this header marks a heartbeat packet (no messages)
+        bool is_heartbeat() const {
+            return message_count == protocol::HEARTBEAT_COUNT;
+        }
+
+        /// Check if this header marks an end-of-session packet
+        bool is_end_of_session() const {
+            return message_count == protocol::END_OF_SESSION;
+        }
+
+        /// Check if the packet carries actual data messages (not heartbeat/EOS)
+        bool carries_data() const {
+            return !(is_heartbeat() || is_end_of_session());
+        }
+
+        /// Sequence of the last message carried (next expected for heartbeat/EOS)
+        uint64_t last_sequence() const {
+            if (!carries_data()) {
+                // Heartbeat or end-of-session: sequence is next expected, no messages delivered
+                return sequence_number;
+            }
+            return sequence_number + message_count - 1;
+        }
+
         /// Parse header from buffer
         [[nodiscard]] static std::optional<MoldUDP64Header> parse(const uint8_t* buffer, size_t length) {
             if (length < protocol::HEADER_SIZE) {
@@ -227,59 +299,37 @@ namespace hft::network {
     };
 
     // ============================================================================
-    // MOLDUDP64 PACKET
+    // MESSAGE BLOCK WALKER
     // ============================================================================
 
-    /// Complete MoldUDP64 packet with header and messages
-    struct MoldUDP64Packet {
-        MoldUDP64Header header;
-        std::vector<MessageBlock> messages;
-
-        /// Parse packet from buffer
-        /// 
-        /// ⚠️ LIFETIME WARNING: The returned MoldUDP64Packet contains MessageBlocks
-        /// that point directly into `buffer`. The caller MUST ensure `buffer` stays
-        /// alive at least until it finishes consuming `packet.messages`. Do not stash
-        /// these MessageBlocks beyond that scope.
-        /// 
-        /// NOTE: Malformed packets that fail to parse are dropped. The next valid packet
-        /// will trigger a gap in SequenceTracker, which will request retransmit for the
-        /// dropped sequences. This is intentional and correct behavior.
-        [[nodiscard]] static std::optional<MoldUDP64Packet> parse(const uint8_t* buffer, size_t length) {
-            // Parse header
-            auto header_opt = MoldUDP64Header::parse(buffer, length);
-            if (!header_opt) {
-                return std::nullopt;
-            }
-
-            MoldUDP64Packet packet;
-            packet.header = *header_opt;
-
-            // Handle special cases
-            if (packet.header.message_count == 0) {
-                // Heartbeat packet (valid, no messages, carries next expected seq)
-                return packet;
-            }
-
-            if (packet.header.message_count == protocol::END_OF_SESSION) {
-                // End-of-session marker (valid, no messages, allows brief retransmit window)
-                return packet;
+    namespace detail {
+        /// Validate the message blocks that follow an already-parsed header
+        ///
+        /// Shared by every packet representation below so that all of them accept
+        /// and reject exactly the same datagrams. `on_block(length, data, index)` is
+        /// invoked once per block in wire order; it must not retain `data` beyond the
+        /// lifetime of `buffer` (see MessageBlock lifetime warning).
+        ///
+        /// @return Offset one past the last block, or std::nullopt if malformed
+        template<typename OnBlock>
+        [[nodiscard]] inline std::optional<size_t> walk_message_blocks(
+            const uint8_t* buffer, size_t length,
+            const MoldUDP64Header& header, OnBlock&& on_block)
+        {
+            // Heartbeat and end-of-session carry no message blocks
+            if (!header.carries_data()) {
+                return protocol::HEADER_SIZE;
             }
 
-            if (packet.header.message_count > protocol::MAX_MESSAGES_PER_PACKET) {
+            if (header.message_count > protocol::MAX_MESSAGES_PER_PACKET) {
                 // TODO(metrics): Increment excessive_message_count
                 // NOTE: MAX_MESSAGES_PER_PACKET is a defensive limit, not a spec limit
                 return std::nullopt;  // Unreasonable message count
             }
 
-            // Extract message blocks
             size_t offset = protocol::HEADER_SIZE;
-            packet.messages.reserve(packet.header.message_count);
-            
-            // Base sequence number for this packet's messages
-            uint64_t base_seq = packet.header.sequence_number;
 
-            for (uint16_t i = 0; i < packet.header.message_count; ++i) {
+            for (uint16_t i = 0; i < header.message_count; ++i) {
                 // Need at least 2 bytes for message length
                 if (offset + 2 > length) {
                     // TODO(metrics): Increment truncated_packet_count
@@ -287,7 +337,7 @@ namespace hft::network {
                 }
 
                 // Read message length (2 bytes big-endian)
-                uint16_t msg_length = detail::read_be16(buffer + offset);
+                uint16_t msg_length = read_be16(buffer + offset);
                 offset += 2;
 
                 // Validate message length
@@ -303,22 +353,10 @@ namespace hft::network {
                     return std::nullopt;  // Truncated message
                 }
 
-                // Create message block (zero-copy: just point to buffer)
-                MessageBlock block;
-                block.length = msg_length;
-                block.data = buffer + offset;
-                block.sequence = base_seq + i;  // Absolute sequence number for this message
-                packet.messages.push_back(block);
-
+                on_block(msg_length, buffer + offset, i);
                 offset += msg_length;
             }
 
-            // Verify we consumed the expected number of messages
-            if (packet.messages.size() != packet.header.message_count) {
-                // TODO(metrics): Increment malformed_packet_count
-                return std::nullopt;
-            }
-
             // Check for trailing garbage bytes (diagnostic/security)
             // In production, this detects spec version mismatches or NIC padding issues
             if (offset != length) {
@@ -327,22 +365,86 @@ namespace hft::network {
                 // In strict mode, you might: return std::nullopt;
             }
 
+            return offset;
+        }
+    } // namespace detail
+
+    // ============================================================================
+    // MOLDUDP64 PACKET
+    // ============================================================================
+
+    /// Complete MoldUDP64 packet with header and messages
+    ///
+    /// NOTE: Owns a vector, so parse() allocates once per data packet - from
+    /// the global heap unless a memory resource (e.g. a per-packet
+    /// MonotonicArena) is passed. Hot paths should prefer MoldUDP64PacketView
+    /// (zero allocation, sequential) or MoldUDP64InlinePacket (zero
+    /// allocation, random access).
+    struct MoldUDP64Packet {
+        MoldUDP64Header header;
+        std::pmr::vector<MessageBlock> messages;
+
+        /// Parse packet from buffer
+        /// 
+        /// ⚠️ LIFETIME WARNING: The returned MoldUDP64Packet contains MessageBlocks
+        /// that point directly into `buffer`. The caller MUST ensure `buffer` stays
+        /// alive at least until it finishes consuming `packet.messages`. Do not stash
+        /// these MessageBlocks beyond that scope.
+        /// 
+        /// NOTE: Malformed packets that fail to parse are dropped. The next valid packet
+        /// will trigger a gap in SequenceTracker, which will request retransmit for the
+        /// dropped sequences. This is intentional and correct behavior.
+        [[nodiscard]] static std::optional<MoldUDP64Packet> parse(const uint8_t* buffer, size_t length) {
+            return parse(buffer, length, std::pmr::get_default_resource());
+        }
+
+        /// Parse packet, allocating `messages` from `resource`
+        ///
+        /// The packet must not outlive `resource` (for an arena: the next reset()).
+        [[nodiscard]] static std::optional<MoldUDP64Packet> parse(const uint8_t* buffer, size_t length,
+                                                                  std::pmr::memory_resource* resource) {
+            // Parse header
+            auto header_opt = MoldUDP64Header::parse(buffer, length);
+            if (!header_opt) {
+                return std::nullopt;
+            }
+
+            MoldUDP64Packet packet{{}, std::pmr::vector<MessageBlock>(resource)};
+            packet.header = *header_opt;
+
+            if (packet.header.carries_data() &&
+                packet.header.message_count <= protocol::MAX_MESSAGES_PER_PACKET) {
+                packet.messages.reserve(packet.header.message_count);
+            }
+
+            // Base sequence number for this packet's messages
+            const uint64_t base_seq = packet.header.sequence_number;
+
+            // Create message blocks (zero-copy: just point to buffer)
+            auto end = detail::walk_message_blocks(buffer, length, packet.header,
+                [&](uint16_t msg_length, const uint8_t* data, uint16_t i) {
+                    packet.messages.push_back({msg_length, data, base_seq + i});
+                });
+            if (!end) {
+                return std::nullopt;
+            }
+
             return packet;
         }
 
         /// Check if this is a heartbeat packet (no messages)
         bool is_heartbeat() const {
-            return header.message_count == protocol::HEARTBEAT_COUNT;
+            return header.is_heartbeat();
         }
 
         /// Check if this is an end-of-session packet
         bool is_end_of_session() const {
-            return header.message_count == protocol::END_OF_SESSION;
+            return header.is_end_of_session();
         }
         
         /// Check if this packet carries actual data messages (not heartbeat/EOS)
         bool carries_data() const {
-            return !(is_heartbeat() || is_end_of_session());
+            return header.carries_data();
         }
 
         /// Get the sequence number of the first message in this packet
@@ -353,12 +455,192 @@ namespace hft::network {
 
         /// Get the sequence number of the last message in this packet
         uint64_t last_sequence() const {
-            if (header.message_count == 0 || header.message_count == protocol::END_OF_SESSION) {
-                // Heartbeat or end-of-session: sequence is next expected, no messages delivered
-                return header.sequence_number;
+            return header.last_sequence();
+        }
+    };
+
+    // ============================================================================
+    // ZERO-ALLOCATION PACKET VIEW
+    // ============================================================================
+
+    /// Forward iterator over the message blocks of a validated packet
+    ///
+    /// Decodes each 2-byte length prefix on the fly and yields MessageBlock by
+    /// value. Only constructed by MoldUDP64PacketView, which has already
+    /// bounds-checked every block, so increments are unchecked.
+    class MessageBlockIterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;  // reference is a prvalue
+        using value_type = MessageBlock;
+        using difference_type = std::ptrdiff_t;
+        using reference = MessageBlock;
+
+        MessageBlockIterator() = default;
+
+        MessageBlock operator*() const {
+            return {detail::read_be16(pos_), pos_ + 2, sequence_};
+        }
+
+        MessageBlockIterator& operator++() {
+            pos_ += 2 + detail::read_be16(pos_);
+            ++sequence_;
+            return *this;
+        }
+
+        MessageBlockIterator operator++(int) {
+            MessageBlockIterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const MessageBlockIterator& other) const {
+            return pos_ == other.pos_;
+        }
+
+    private:
+        friend class MoldUDP64PacketView;
+
+        MessageBlockIterator(const uint8_t* pos, uint64_t sequence)
+            : pos_(pos), sequence_(sequence) {}
+
+        const uint8_t* pos_{nullptr};  // Points at the next block's length prefix
+        uint64_t sequence_{0};         // Absolute sequence of the block at pos_
+    };
+
+    /// Non-owning view of a MoldUDP64 packet that walks message blocks in place
+    ///
+    /// parse() validates the whole datagram up front (same rules as
+    /// MoldUDP64Packet::parse), then iteration re-reads the length prefixes
+    /// directly from the receive buffer. No heap allocation, 40 bytes on the stack.
+    ///
+    /// Trade-off: validation and iteration are two passes over the same
+    /// length-prefix chain. Cheapest for heartbeats and small packets; for
+    /// MTU-sized bursts MoldUDP64InlinePacket (one pass) is usually faster.
+    ///
+    /// ⚠️ LIFETIME WARNING: Same as MoldUDP64Packet - the view and every
+    /// MessageBlock it yields point into `buffer`.
+    ///
+    /// Example usage:
+    /// @code
+    /// if (auto view = MoldUDP64PacketView::parse(buf, len)) {
+    ///     auto gap = tracker.process_packet(*view);
+    ///     for (MessageBlock block : *view) {
+    ///         handle(block);
+    ///     }
+    /// }
+    /// @endcode
+    class MoldUDP64PacketView {
+    public:
+        MoldUDP64Header header;
+
+        /// Parse and validate packet, without materializing message blocks
+        [[nodiscard]] static std::optional<MoldUDP64PacketView> parse(const uint8_t* buffer, size_t length) {
+            auto header_opt = MoldUDP64Header::parse(buffer, length);
+            if (!header_opt) {
+                return std::nullopt;
+            }
+
+            auto end = detail::walk_message_blocks(buffer, length, *header_opt,
+                [](uint16_t, const uint8_t*, uint16_t) {});
+            if (!end) {
+                return std::nullopt;
+            }
+
+            MoldUDP64PacketView view;
+            view.header = *header_opt;
+            view.blocks_begin_ = buffer + protocol::HEADER_SIZE;
+            view.blocks_end_ = buffer + *end;
+            return view;
+        }
+
+        MessageBlockIterator begin() const {
+            return {blocks_begin_, header.sequence_number};
+        }
+
+        MessageBlockIterator end() const {
+            return {blocks_end_, header.sequence_number + size()};
+        }
+
+        /// Number of message blocks (0 for heartbeat/end-of-session)
+        size_t size() const {
+            return header.carries_data() ? header.message_count : 0;
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        bool is_heartbeat() const { return header.is_heartbeat(); }
+        bool is_end_of_session() const { return header.is_end_of_session(); }
+        bool carries_data() const { return header.carries_data(); }
+        uint64_t first_sequence() const { return header.sequence_number; }
+        uint64_t last_sequence() const { return header.last_sequence(); }
+
+    private:
+        const uint8_t* blocks_begin_{nullptr};
+        const uint8_t* blocks_end_{nullptr};
+    };
+
+    // ============================================================================
+    // FIXED-CAPACITY INLINE PACKET
+    // ============================================================================
+
+    /// MoldUDP64 packet with message blocks stored in an inline array
+    ///
+    /// For callers that need random access (e.g. index into a packet while
+    /// handling a retransmit) without the per-packet heap allocation of
+    /// MoldUDP64Packet. Capacity is MAX_MESSAGES_PER_PACKET, which parse()
+    /// already enforces. At ~2.4 KB it is meant to be reused: keep one per
+    /// receive thread and parse() into it.
+    ///
+    /// ⚠️ LIFETIME WARNING: Same as MoldUDP64Packet.
+    class MoldUDP64InlinePacket {
+    public:
+        MoldUDP64Header header{};
+
+        /// Parse packet into this object, replacing previous contents
+        ///
+        /// @return false if malformed (contents are then unspecified)
+        [[nodiscard]] bool parse(const uint8_t* buffer, size_t length) {
+            count_ = 0;
+
+            auto header_opt = MoldUDP64Header::parse(buffer, length);
+            if (!header_opt) {
+                return false;
             }
-            return header.sequence_number + header.message_count - 1;
+            header = *header_opt;
+
+            const uint64_t base_seq = header.sequence_number;
+            auto end = detail::walk_message_blocks(buffer, length, header,
+                [&](uint16_t msg_length, const uint8_t* data, uint16_t i) {
+                    blocks_[i] = {msg_length, data, base_seq + i};
+                });
+            if (!end) {
+                return false;
+            }
+
+            count_ = header.carries_data() ? header.message_count : 0;
+            return true;
         }
+
+        const MessageBlock& operator[](size_t index) const { return blocks_[index]; }
+        const MessageBlock* begin() const { return blocks_.data(); }
+        const MessageBlock* end() const { return blocks_.data() + count_; }
+        size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        static constexpr size_t capacity() { return protocol::MAX_MESSAGES_PER_PACKET; }
+
+        bool is_heartbeat() const { return header.is_heartbeat(); }
+        bool is_end_of_session() const { return header.is_end_of_session(); }
+        bool carries_data() const { return header.carries_data(); }
+        uint64_t first_sequence() const { return header.sequence_number; }
+        uint64_t last_sequence() const { return header.last_sequence(); }
+
+    private:
+        std::array<MessageBlock, protocol::MAX_MESSAGES_PER_PACKET> blocks_;
+        uint16_t count_{0};
     };
 
     // ============================================================================
@@ -370,15 +652,16 @@ namespace hft::network {
         bool has_gap;          // True if a gap was detected
         bool out_of_order;     // True if packet arrived out of order (seq < expected)
         bool session_changed;  // True if session ID changed (caller should reset state)
+        bool session_rejected; // True if session ID != configured expected session (packet ignored)
         uint64_t gap_start;    // First missing sequence number
         uint64_t gap_count;    // Number of missing messages
         
         /// Constructor for no gap, in-order
-        GapInfo() : has_gap(false), out_of_order(false), session_changed(false), gap_start(0), gap_count(0) {}
+        GapInfo() : has_gap(false), out_of_order(false), session_changed(false), session_rejected(false), gap_start(0), gap_count(0) {}
         
         /// Constructor for gap
         GapInfo(uint64_t start, uint64_t count) 
-            : has_gap(true), out_of_order(false), session_changed(false), gap_start(start), gap_count(count) {}
+            : has_gap(true), out_of_order(false), session_changed(false), session_rejected(false), gap_start(start), gap_count(count) {}
         
         /// Constructor for out-of-order/duplicate
         static GapInfo out_of_order_packet() {
@@ -393,6 +676,13 @@ namespace hft::network {
             info.session_changed = true;
             return info;
         }
+        
+        /// Constructor for packet from an unexpected session
+        static GapInfo session_mismatch() {
+            GapInfo info;
+            info.session_rejected = true;
+            return info;
+        }
     };
 
     /// Tracks sequence numbers and detects gaps
@@ -407,12 +697,47 @@ namespace hft::network {
             : expected_sequence_(0)
             , initialized_(false)
             , end_of_session_(false)
+            , has_expected_session_(false)
+            , current_fingerprint_{}
+            , expected_fingerprint_{}
             , current_session_{}
+            , expected_session_{}
         {}
 
+        /// Only accept packets from this session ID (trailing padding ignored)
+        ///
+        /// Packets from any other session are reported with session_rejected and
+        /// leave the tracker untouched - no rollover, no gap. Use this when the
+        /// session ID is known up front (e.g. from the retransmit server login)
+        /// to ignore stale or misrouted multicast traffic. Call again with the
+        /// new ID when rolling to the next session.
+        ///
+        /// @return false if `session` is longer than 10 characters (not applied)
+        [[nodiscard]] bool set_expected_session(std::string_view session) {
+            if (session.size() > protocol::SESSION_ID_LENGTH) {
+                return false;
+            }
+            expected_session_.fill(' ');
+            std::memcpy(expected_session_.data(), session.data(), session.size());
+            expected_fingerprint_ = detail::SessionFingerprint::from(expected_session_);
+            has_expected_session_ = true;
+            return true;
+        }
+
+        /// Accept packets from any session again (rollover on change)
+        void clear_expected_session() {
+            has_expected_session_ = false;
+        }
+
+        /// Get the configured expected session (empty if none)
+        std::string_view expected_session() const {
+            return has_expected_session_ ? detail::normalize_session(expected_session_)
+                                         : std::string_view{};
+        }
+
         /// Process a packet and detect gaps
         /// 
-        /// @param packet The MoldUDP64 packet to process
+        /// @param header Header of the MoldUDP64 packet to process
         /// @return GapInfo containing gap details (start sequence and count) if gap detected
         /// 
         /// IMPORTANT: If a gap is detected, use gap_start and gap_count to issue
@@ -424,44 +749,57 @@ namespace hft::network {
         /// 
         /// NOTE: Session comparison uses normalized (trimmed) session IDs, so
         /// "ABCDEF    " and "ABCDEF\0\0\0\0" are considered the same session.
-        [[nodiscard]] GapInfo process_packet(const MoldUDP64Packet& packet) {
-            uint64_t first_seq = packet.first_sequence();
-            auto new_session = detail::normalize_session(packet.header.session);
+        /// The common case (identical bytes) is a precomputed fingerprint compare;
+        /// trimming only happens when the raw bytes differ, and only once per
+        /// padding variant: a match caches the wire form's fingerprint.
+        [[nodiscard]] GapInfo process_packet(const MoldUDP64Header& header) {
+            uint64_t first_seq = header.sequence_number;
+            const auto incoming = detail::SessionFingerprint::from(header.session);
+
+            // Reject packets from a session other than the configured one
+            if (has_expected_session_ &&
+                !detail::same_session(incoming, header.session,
+                                      expected_fingerprint_, expected_session_)) {
+                // Counted by the caller (see ChannelStats::session_rejects)
+                return GapInfo::session_mismatch();
+            }
 
             // First packet initializes the tracker
             if (!initialized_) {
-                current_session_ = packet.header.session;
+                current_session_ = header.session;
+                current_fingerprint_ = incoming;
                 initialized_ = true;
                 
                 // Set expected_sequence based on packet type
-                if (packet.is_heartbeat() || packet.is_end_of_session()) {
+                if (header.is_heartbeat() || header.is_end_of_session()) {
                     // Heartbeat/EOS: sequence_number IS the next expected
                     expected_sequence_ = first_seq;
-                    end_of_session_ = packet.is_end_of_session();
+                    end_of_session_ = header.is_end_of_session();
                 } else {
                     // Normal packet: advance past all messages in this packet
-                    expected_sequence_ = packet.last_sequence() + 1;
+                    expected_sequence_ = header.last_sequence() + 1;
                 }
                 
                 return GapInfo();  // No gap on initialization
             }
 
             // Check for session rollover (NASDAQ resets sequence and bumps session ID)
-            auto cur_session = detail::normalize_session(current_session_);
-            if (new_session != cur_session) {
+            if (!detail::same_session(incoming, header.session,
+                                      current_fingerprint_, current_session_)) {
                 // Session changed - this is a regime change
                 // Do NOT compute gap across session boundaries (would underflow)
                 // Instead, re-initialize tracker with new session
                 
-                current_session_ = packet.header.session;
+                current_session_ = header.session;
+                current_fingerprint_ = incoming;
                 end_of_session_ = false;
                 
                 // Re-initialize expected_sequence based on packet type
-                if (packet.is_heartbeat() || packet.is_end_of_session()) {
+                if (header.is_heartbeat() || header.is_end_of_session()) {
                     expected_sequence_ = first_seq;
-                    end_of_session_ = packet.is_end_of_session();
+                    end_of_session_ = header.is_end_of_session();
                 } else {
-                    expected_sequence_ = packet.last_sequence() + 1;
+                    expected_sequence_ = header.last_sequence() + 1;
                 }
                 
                 // Return session_changed flag so caller can reset order books/state
@@ -482,21 +820,34 @@ namespace hft::network {
 
             // Update expected sequence for next packet
             // IMPORTANT: Do this AFTER computing gap info so caller has correct gap_start
-            if (packet.is_heartbeat()) {
+            if (header.is_heartbeat()) {
                 // Heartbeat: sequence field IS the next expected, don't advance
                 expected_sequence_ = first_seq;
-            } else if (packet.is_end_of_session()) {
+            } else if (header.is_end_of_session()) {
                 // End-of-session: sequence field IS the next expected, mark session ended
                 expected_sequence_ = first_seq;
                 end_of_session_ = true;
             } else {
                 // Normal packet: advance by number of messages
-                expected_sequence_ = packet.last_sequence() + 1;
+                expected_sequence_ = header.last_sequence() + 1;
             }
 
             return gap_info;
         }
 
+        /// Convenience overloads: gap detection only needs the packet header
+        [[nodiscard]] GapInfo process_packet(const MoldUDP64Packet& packet) {
+            return process_packet(packet.header);
+        }
+
+        [[nodiscard]] GapInfo process_packet(const MoldUDP64PacketView& packet) {
+            return process_packet(packet.header);
+        }
+
+        [[nodiscard]] GapInfo process_packet(const MoldUDP64InlinePacket& packet) {
+            return process_packet(packet.header);
+        }
+
         /// Get the next expected sequence number
         uint64_t expected_sequence() const {
             return expected_sequence_;
@@ -523,13 +874,19 @@ namespace hft::network {
             initialized_ = false;
             end_of_session_ = false;
             current_session_.fill('\0');
+            current_fingerprint_ = {};
+            // Expected session is configuration, not state: kept across reset()
         }
 
     private:
         uint64_t expected_sequence_;
         bool initialized_;
         bool end_of_session_;
+        bool has_expected_session_;
+        detail::SessionFingerprint current_fingerprint_;   // Hot: compared every packet
+        detail::SessionFingerprint expected_fingerprint_;
         std::array<char, protocol::SESSION_ID_LENGTH> current_session_;
+        std::array<char, protocol::SESSION_ID_LENGTH> expected_session_;
     };
 
 } // namespace hft::network
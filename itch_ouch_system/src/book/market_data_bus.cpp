@@ -0,0 +1,241 @@
+#include "book/market_data_bus.hpp"
+#include "book/order_book.hpp"
+#include "process_liveness.hpp"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hft {
+
+    namespace {
+
+        std::string_view trim_symbol(std::string_view symbol) {
+            size_t end = symbol.find_last_not_of(' ');
+            return symbol.substr(0, end == std::string_view::npos ? 0 : end + 1);
+        }
+
+        /// True if `name` is a bus segment whose writer process still exists
+        bool owned_by_live_writer(const std::string& name) {
+            int fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) {
+                return false;
+            }
+            struct stat st {};
+            void* base = MAP_FAILED;
+            if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(BusHeader)) {
+                base = mmap(nullptr, sizeof(BusHeader), PROT_READ, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+            if (base == MAP_FAILED) {
+                return false;  // Empty or truncated: a writer died while creating it
+            }
+
+            const auto* header = static_cast<const BusHeader*>(base);
+            const bool live = header->magic == bus::MAGIC &&
+                              header->state.load(std::memory_order_acquire) != static_cast<uint32_t>(bus::State::CLOSED) &&
+                              memory::process_alive(header->writer_pid.load(std::memory_order_acquire));
+            munmap(base, sizeof(BusHeader));
+            return live;
+        }
+
+    } // namespace
+
+    // ========================================================================
+    // WRITER
+    // ========================================================================
+
+    std::optional<MarketDataBusWriter> MarketDataBusWriter::create(const std::string& name, uint32_t max_symbols) {
+        if (max_symbols == 0) {
+            return std::nullopt;
+        }
+        const size_t size = bus_segment_size(max_symbols);
+
+        // Never take the name from a running writer. A stale segment left by
+        // a crashed one is replaced: readers still mapping it keep the old
+        // object, new readers get the fresh one. (Not a lock - two writers
+        // starting at the same instant are still arbitrated only by O_EXCL.)
+        if (owned_by_live_writer(name)) {
+            return std::nullopt;
+        }
+        shm_unlink(name.c_str());
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return std::nullopt;
+        }
+
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);  // The mapping keeps the object alive
+        if (base == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            return std::nullopt;
+        }
+
+        // Construct header and slots in place (ftruncate zero-filled the memory)
+        auto* header = new (base) BusHeader();
+        auto* slots = reinterpret_cast<BusSymbolSlot*>(static_cast<char*>(base) + sizeof(BusHeader));
+        for (uint32_t i = 0; i < max_symbols; ++i) {
+            new (&slots[i]) BusSymbolSlot();
+        }
+
+        header->writer_pid.store(getpid(), std::memory_order_relaxed);
+        header->magic = bus::MAGIC;
+        header->version = bus::VERSION;
+        header->max_symbols = max_symbols;
+        header->segment_size = size;
+        header->state.store(static_cast<uint32_t>(bus::State::LIVE), std::memory_order_release);
+
+        return MarketDataBusWriter(name, base, size);
+    }
+
+    MarketDataBusWriter::MarketDataBusWriter(std::string name, void* base, size_t size)
+        : name_(std::move(name)),
+          base_(base),
+          size_(size),
+          header_(static_cast<BusHeader*>(base)),
+          slots_(reinterpret_cast<BusSymbolSlot*>(static_cast<char*>(base) + sizeof(BusHeader))) {}
+
+    MarketDataBusWriter::MarketDataBusWriter(MarketDataBusWriter&& other) noexcept
+        : name_(std::move(other.name_)),
+          base_(std::exchange(other.base_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          header_(std::exchange(other.header_, nullptr)),
+          slots_(std::exchange(other.slots_, nullptr)) {}
+
+    MarketDataBusWriter::~MarketDataBusWriter() {
+        if (!base_) {
+            return;
+        }
+        header_->state.store(static_cast<uint32_t>(bus::State::CLOSED), std::memory_order_release);
+        munmap(base_, size_);
+        shm_unlink(name_.c_str());
+    }
+
+    std::optional<uint32_t> MarketDataBusWriter::add_symbol(uint16_t stock_locate, std::string_view symbol) {
+        const uint32_t index = header_->symbol_count.load(std::memory_order_relaxed);
+        if (index >= header_->max_symbols) {
+            return std::nullopt;
+        }
+
+        BusSymbolSlot& slot = slots_[index];
+        symbol = trim_symbol(symbol);
+        slot.symbol.fill(' ');
+        std::copy_n(symbol.begin(), std::min(symbol.size(), slot.symbol.size()), slot.symbol.begin());
+        slot.stock_locate = stock_locate;
+
+        // Publish: readers that see the new count also see the directory entry
+        header_->symbol_count.store(index + 1, std::memory_order_release);
+        return index;
+    }
+
+    void MarketDataBusWriter::publish(uint32_t slot, const OrderBook& book) {
+        BusDepth depth;
+        depth.sequence = book.last_sequence();
+        depth.bid_count = static_cast<uint32_t>(book.get_depth(Side::BUY, depth.bids.data(), depth.bids.size()));
+        depth.ask_count = static_cast<uint32_t>(book.get_depth(Side::SELL, depth.asks.data(), depth.asks.size()));
+
+        publish_top(slot, book.get_top_of_book());
+        publish_depth(slot, depth);
+    }
+
+    // ========================================================================
+    // READER
+    // ========================================================================
+
+    std::optional<MarketDataBusReader> MarketDataBusReader::attach(const std::string& name) {
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+
+        struct stat st {};
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BusHeader)) {
+            close(fd);
+            return std::nullopt;
+        }
+        const size_t size = static_cast<size_t>(st.st_size);
+
+        void* base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            return std::nullopt;
+        }
+
+        // The writer stores state with release after filling the header, so an
+        // acquire load of state != INITIALIZING makes the header fields valid.
+        const auto* header = static_cast<const BusHeader*>(base);
+        const bool valid = header->state.load(std::memory_order_acquire) != static_cast<uint32_t>(bus::State::INITIALIZING) &&
+                           header->magic == bus::MAGIC &&
+                           header->version == bus::VERSION &&
+                           header->segment_size == size &&
+                           bus_segment_size(header->max_symbols) == size;
+        if (!valid) {
+            munmap(base, size);
+            return std::nullopt;
+        }
+
+        return MarketDataBusReader(base, size);
+    }
+
+    MarketDataBusReader::MarketDataBusReader(void* base, size_t size)
+        : base_(base),
+          size_(size),
+          header_(static_cast<const BusHeader*>(base)),
+          slots_(reinterpret_cast<const BusSymbolSlot*>(static_cast<const char*>(base) + sizeof(BusHeader))) {}
+
+    MarketDataBusReader::MarketDataBusReader(MarketDataBusReader&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          header_(std::exchange(other.header_, nullptr)),
+          slots_(std::exchange(other.slots_, nullptr)) {}
+
+    MarketDataBusReader::~MarketDataBusReader() {
+        detach();
+    }
+
+    void MarketDataBusReader::detach() {
+        if (base_) {
+            munmap(base_, size_);
+            base_ = nullptr;
+            header_ = nullptr;
+            slots_ = nullptr;
+        }
+    }
+
+    std::optional<uint32_t> MarketDataBusReader::find(std::string_view symbol) const {
+        symbol = trim_symbol(symbol);
+        const uint32_t count = symbol_count();
+        for (uint32_t i = 0; i < count; ++i) {
+            if (this->symbol(i) == symbol) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<uint32_t> MarketDataBusReader::find(uint16_t stock_locate) const {
+        const uint32_t count = symbol_count();
+        for (uint32_t i = 0; i < count; ++i) {
+            if (slots_[i].stock_locate == stock_locate) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::string_view MarketDataBusReader::symbol(uint32_t slot) const {
+        return trim_symbol(std::string_view(slots_[slot].symbol.data(), slots_[slot].symbol.size()));
+    }
+
+} // namespace hft
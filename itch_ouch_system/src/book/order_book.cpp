@@ -2,6 +2,9 @@
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <variant>
 
 namespace hft {
 
@@ -11,13 +14,26 @@ namespace hft {
     constexpr Price MAX_PRICE_LEVELS = 2000 * 10000;
 
     OrderBook::OrderBook(uint16_t stock_locate, const std::string& symbol)
+        : OrderBook(stock_locate, symbol, MappedAllocator<PriceLevel>{}, 0) {}
+
+    OrderBook::OrderBook(uint16_t stock_locate, const std::string& symbol, const BackingOptions& backing,
+                         size_t expected_orders)
+        : OrderBook(stock_locate, symbol, MappedAllocator<PriceLevel>(backing), expected_orders) {}
+
+    OrderBook::OrderBook(uint16_t stock_locate, const std::string& symbol,
+                         const MappedAllocator<PriceLevel>& allocator, size_t expected_orders)
         : stock_locate_(stock_locate),
           symbol_(symbol),
-          bids_(MAX_PRICE_LEVELS, {0, 0, 0}),
-          asks_(MAX_PRICE_LEVELS, {0, 0, 0}),
+          bids_(MAX_PRICE_LEVELS, {0, 0, 0}, allocator),
+          asks_(MAX_PRICE_LEVELS, {0, 0, 0}, allocator),
+          orders_(OrderIndex::allocator_type(allocator)),
           best_bid_price_(0),
           best_ask_price_(MAX_PRICE_LEVELS - 1) {
         
+        if (expected_orders != 0) {
+            orders_.reserve(expected_orders);
+        }
+
         // Trim spaces from symbol to match ITCH message format
         size_t end = symbol_.find_last_not_of(' ');
         if (end != std::string::npos) {
@@ -44,6 +60,7 @@ namespace hft {
 
         // Store the order details for future modifications (cancel, delete, replace)
         orders_[msg.order_reference] = {price, msg.shares, msg.side()};
+        mark_dirty(msg.side(), price);
 
         if (msg.side() == Side::BUY) {
             bids_[price].quantity += msg.shares;
@@ -58,7 +75,7 @@ namespace hft {
                 best_ask_price_ = price;
             }
         }
-        update_top_of_book();
+        on_book_changed();
     }
     
     void OrderBook::execute_order(const itch::OrderExecuted& msg) {
@@ -69,6 +86,7 @@ namespace hft {
 
         Order& order = it->second;
         Price price = order.price;
+        mark_dirty(order.side, price);
 
         if (order.side == Side::BUY) {
             bids_[price].quantity -= msg.executed_shares;
@@ -91,7 +109,7 @@ namespace hft {
         // Note: For simplicity, we don't update best bid/ask on execution here.
         // A real implementation would need to scan for the next best price if the
         // best price level is depleted. We'll add this logic later.
-        update_top_of_book();
+        on_book_changed();
     }
     
     void OrderBook::execute_order_with_price(const itch::OrderExecutedWithPrice& msg) {
@@ -106,6 +124,7 @@ namespace hft {
 
         Order& order = it->second;
         Price price = order.price;
+        mark_dirty(order.side, price);
 
         // Reduce quantity at the price level
         if (order.side == Side::BUY) {
@@ -127,7 +146,7 @@ namespace hft {
             orders_.erase(it);
         }
         
-        update_top_of_book();
+        on_book_changed();
     }
 
     void OrderBook::cancel_order(const itch::OrderCancel& msg) {
@@ -138,6 +157,7 @@ namespace hft {
 
         Order& order = it->second;
         Price price = order.price;
+        mark_dirty(order.side, price);
         uint32_t cancelled_shares = msg.cancelled_shares;
 
         // Ensure we don't cancel more shares than the order has
@@ -162,7 +182,7 @@ namespace hft {
             orders_.erase(it);
         }
         
-        update_top_of_book();
+        on_book_changed();
     }
 
     void OrderBook::delete_order(const itch::OrderDelete& msg) {
@@ -173,6 +193,7 @@ namespace hft {
 
         const Order& order = it->second;
         Price price = order.price;
+        mark_dirty(order.side, price);
 
         if (order.side == Side::BUY) {
             bids_[price].quantity -= order.shares;
@@ -186,7 +207,7 @@ namespace hft {
 
         // This is a simplification. A real implementation needs to handle the
         // case where the deleted order was at the best bid or ask.
-        update_top_of_book();
+        on_book_changed();
     }
 
     void OrderBook::replace_order(const itch::OrderReplace& msg) {
@@ -202,6 +223,7 @@ namespace hft {
 
         const Order old_order = it->second;
         Price old_price = old_order.price;
+        mark_dirty(old_order.side, old_price);
 
         if (old_order.side == Side::BUY) {
             bids_[old_price].quantity -= old_order.shares;
@@ -220,12 +242,13 @@ namespace hft {
             // Note: We've already removed the old order. A production system would
             // need a strategy for this scenario (e.g., reject, or add back old order).
             // For now, we proceed, leaving the old order removed.
-            update_top_of_book();
+            on_book_changed();
             return;
         }
 
         Side side = old_order.side; // Side is not in replace message, must be inferred
         orders_[msg.new_order_reference] = {new_price, msg.shares, side};
+        mark_dirty(side, new_price);
 
         if (side == Side::BUY) {
             bids_[new_price].quantity += msg.shares;
@@ -241,13 +264,187 @@ namespace hft {
             }
         }
 
-        update_top_of_book();
+        on_book_changed();
+    }
+
+    void OrderBook::apply(const itch::ITCHMessage& msg) {
+        std::visit([this](const auto& m) {
+            using T = std::decay_t<decltype(m)>;
+            if constexpr (std::is_same_v<T, itch::AddOrder>) {
+                add_order(m);
+            } else if constexpr (std::is_same_v<T, itch::OrderExecuted>) {
+                execute_order(m);
+            } else if constexpr (std::is_same_v<T, itch::OrderExecutedWithPrice>) {
+                execute_order_with_price(m);
+            } else if constexpr (std::is_same_v<T, itch::OrderCancel>) {
+                cancel_order(m);
+            } else if constexpr (std::is_same_v<T, itch::OrderDelete>) {
+                delete_order(m);
+            } else if constexpr (std::is_same_v<T, itch::OrderReplace>) {
+                replace_order(m);
+            }
+        }, msg);
+    }
+
+    void OrderBook::apply(const itch::ITCHMessage& msg, uint64_t sequence) {
+        assert(sequence > last_sequence_ && "MoldUDP64 sequences must increase");
+        last_sequence_ = sequence;
+        apply(msg);
+    }
+
+    void OrderBook::capture_snapshot(BookSnapshot& out) const {
+        out.clear();
+        out.stock_locate = stock_locate_;
+        out.symbol.fill(' ');
+        std::copy_n(symbol_.begin(), std::min(symbol_.size(), out.symbol.size()), out.symbol.begin());
+        out.last_sequence = last_sequence_;
+
+        out.orders.reserve(orders_.size());
+        for (const auto& [reference, order] : orders_) {
+            out.orders.push_back({reference, order.price, order.shares, order.side});
+        }
+    }
+
+    bool OrderBook::restore_snapshot(const BookSnapshot& snapshot) {
+        clear_orders();
+
+        std::string_view snapshot_symbol(snapshot.symbol.data(), snapshot.symbol.size());
+        size_t end = snapshot_symbol.find_last_not_of(' ');
+        snapshot_symbol = snapshot_symbol.substr(0, end == std::string_view::npos ? 0 : end + 1);
+        if (snapshot.stock_locate != stock_locate_ || snapshot_symbol != symbol_) {
+            on_book_changed();
+            return false;
+        }
+
+        orders_.reserve(snapshot.orders.size());
+        for (const SnapshotOrder& order : snapshot.orders) {
+            if (order.price < 0 || order.price >= MAX_PRICE_LEVELS || order.shares == 0) {
+                clear_orders();
+                on_book_changed();
+                return false;
+            }
+            orders_[order.order_reference] = {order.price, order.shares, order.side};
+            mark_dirty(order.side, order.price);
+            auto& ladder = (order.side == Side::BUY) ? bids_ : asks_;
+            ladder[order.price].quantity += order.shares;
+            ladder[order.price].order_count++;
+        }
+
+        // Levels are redundant with orders; a mismatch means a corrupt checkpoint.
+        for (const SnapshotLevel& level : snapshot.levels) {
+            if (level.price < 0 || level.price >= MAX_PRICE_LEVELS) {
+                clear_orders();
+                on_book_changed();
+                return false;
+            }
+            const auto& ladder = (level.side == Side::BUY) ? bids_ : asks_;
+            if (ladder[level.price].quantity != level.quantity ||
+                ladder[level.price].order_count != level.order_count) {
+                clear_orders();
+                on_book_changed();
+                return false;
+            }
+        }
+
+        last_sequence_ = snapshot.last_sequence;
+        on_book_changed();
+        return true;
+    }
+
+    void OrderBook::clear_orders() {
+        // Only touch levels that hold orders instead of resetting both ladders.
+        for (const auto& [reference, order] : orders_) {
+            auto& ladder = (order.side == Side::BUY) ? bids_ : asks_;
+            ladder[order.price] = {0, 0, 0};
+            mark_dirty(order.side, order.price);
+        }
+        orders_.clear();
+        last_sequence_ = 0;
+    }
+
+    void OrderBook::set_delta_ring(BookDeltaRing* ring) {
+        delta_ring_ = ring;
+        dirty_levels_.clear();
+        // One packet rarely touches more than a few hundred levels; reserve so
+        // the hot path does not allocate.
+        dirty_levels_.reserve(1024);
+    }
+
+    bool OrderBook::end_batch() {
+        in_batch_ = false;
+        return publish_deltas();
+    }
+
+    bool OrderBook::end_batch(uint64_t sequence) {
+        assert(sequence >= last_sequence_ && "MoldUDP64 sequences must not go backwards");
+        last_sequence_ = sequence;
+        return end_batch();
+    }
+
+    bool OrderBook::publish_deltas() {
+        if (!delta_ring_ || dirty_levels_.empty()) {
+            return true;
+        }
+
+        // Coalesce: one delta per (side, price) no matter how often it was touched
+        std::sort(dirty_levels_.begin(), dirty_levels_.end(), [](const DirtyLevel& a, const DirtyLevel& b) {
+            return a.side != b.side ? a.side < b.side : a.price < b.price;
+        });
+        auto last = std::unique(dirty_levels_.begin(), dirty_levels_.end(), [](const DirtyLevel& a, const DirtyLevel& b) {
+            return a.side == b.side && a.price == b.price;
+        });
+        dirty_levels_.erase(last, dirty_levels_.end());
+
+        const size_t count = dirty_levels_.size();
+        size_t published = 0;
+        for (; published < count; ++published) {
+            const DirtyLevel& dirty = dirty_levels_[published];
+            const PriceLevel& level = (dirty.side == Side::BUY) ? bids_[dirty.price] : asks_[dirty.price];
+
+            BookDelta delta;
+            delta.sequence = last_sequence_;
+            delta.price = dirty.price;
+            delta.quantity = level.quantity;
+            delta.order_count = level.order_count;
+            delta.stock_locate = stock_locate_;
+            delta.side = dirty.side;
+            delta.flags = (published + 1 == count) ? delta_flags::END_OF_BATCH : 0;
+
+            if (!delta_ring_->try_push(delta)) {
+                break;
+            }
+        }
+
+        dirty_levels_.erase(dirty_levels_.begin(), dirty_levels_.begin() + static_cast<std::ptrdiff_t>(published));
+        if (published < count) {
+            ++delta_overflows_;
+            return false;
+        }
+        return true;
     }
 
     TopOfBook OrderBook::get_top_of_book() const {
         return top_of_book_lock_.read();
     }
     
+    size_t OrderBook::get_depth(Side side, PriceLevel* out, size_t max_levels) const {
+        size_t count = 0;
+        if (side == Side::BUY) {
+            for (Price p = best_bid_price_; p >= 0 && count < max_levels; --p) {
+                if (bids_[p].quantity > 0) {
+                    out[count++] = {p, bids_[p].quantity, bids_[p].order_count};
+                }
+            }
+        } else {
+            for (Price p = best_ask_price_; p < MAX_PRICE_LEVELS && count < max_levels; ++p) {
+                if (asks_[p].quantity > 0) {
+                    out[count++] = {p, asks_[p].quantity, asks_[p].order_count};
+                }
+            }
+        }
+        return count;
+    }
+
     void OrderBook::update_top_of_book() {
         // Scan the entire price range to find the best bid (highest price with quantity > 0)
         Price new_best_bid = 0;
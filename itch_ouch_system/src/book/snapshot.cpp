@@ -0,0 +1,195 @@
+#include "book/snapshot.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hft {
+
+    namespace {
+
+        // FNV-1a (64-bit). Not cryptographic - it only needs to catch torn writes.
+        constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+        uint64_t fnv1a(uint64_t hash, const void* data, size_t length) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < length; ++i) {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+            return hash;
+        }
+
+        uint64_t checksum(const std::vector<SnapshotLevel>& levels,
+                          const std::vector<SnapshotOrder>& orders) {
+            uint64_t hash = FNV_OFFSET_BASIS;
+            hash = fnv1a(hash, levels.data(), levels.size() * sizeof(SnapshotLevel));
+            hash = fnv1a(hash, orders.data(), orders.size() * sizeof(SnapshotOrder));
+            return hash;
+        }
+
+        /// write() until done, retrying short writes and EINTR
+        bool write_all(int fd, const void* data, size_t length) {
+            const auto* bytes = static_cast<const char*>(data);
+            while (length > 0) {
+                const ssize_t n = ::write(fd, bytes, length);
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    return false;
+                }
+                bytes += n;
+                length -= static_cast<size_t>(n);
+            }
+            return true;
+        }
+
+        /// fsync the directory holding `path`, making a rename into it durable
+        bool sync_parent_directory(const std::string& path) {
+            std::filesystem::path dir = std::filesystem::path(path).parent_path();
+            if (dir.empty()) {
+                dir = ".";
+            }
+            const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+            if (fd < 0) {
+                return false;
+            }
+            const bool ok = ::fsync(fd) == 0;
+            const int sync_errno = errno;
+            ::close(fd);
+            errno = sync_errno;
+            return ok;
+        }
+
+    } // namespace
+
+    void BookSnapshot::build_levels() {
+        levels.clear();
+
+        // Sort by side (bids first), then best price first, so equal prices are adjacent
+        std::sort(orders.begin(), orders.end(), [](const SnapshotOrder& a, const SnapshotOrder& b) {
+            if (a.side != b.side) return a.side == Side::BUY;
+            if (a.price != b.price) {
+                return (a.side == Side::BUY) ? a.price > b.price : a.price < b.price;
+            }
+            return a.order_reference < b.order_reference;
+        });
+
+        for (const SnapshotOrder& order : orders) {
+            if (!levels.empty() && levels.back().side == order.side && levels.back().price == order.price) {
+                levels.back().quantity += order.shares;
+                levels.back().order_count++;
+            } else {
+                levels.push_back({order.price, order.shares, 1, order.side});
+            }
+        }
+    }
+
+    void BookSnapshot::clear() {
+        stock_locate = 0;
+        symbol.fill(' ');
+        last_sequence = 0;
+        levels.clear();
+        orders.clear();
+    }
+
+    Result<size_t> save_snapshot(const BookSnapshot& snapshot, const std::string& path) {
+        SnapshotFileHeader header;
+        header.magic = snapshot::MAGIC;
+        header.version = snapshot::VERSION;
+        header.stock_locate = snapshot.stock_locate;
+        header.symbol = snapshot.symbol;
+        header.last_sequence = snapshot.last_sequence;
+        header.level_count = snapshot.levels.size();
+        header.order_count = snapshot.orders.size();
+        header.checksum = checksum(snapshot.levels, snapshot.orders);
+
+        const std::string tmp_path = path + ".tmp";
+        const int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return Result<size_t>::error("Cannot open " + tmp_path + ": " + std::strerror(errno));
+        }
+        const bool written =
+            write_all(fd, &header, sizeof(header)) &&
+            write_all(fd, snapshot.levels.data(), snapshot.levels.size() * sizeof(SnapshotLevel)) &&
+            write_all(fd, snapshot.orders.data(), snapshot.orders.size() * sizeof(SnapshotOrder)) &&
+            ::fdatasync(fd) == 0;  // Data on disk before the rename can expose it
+        const int write_errno = errno;
+        ::close(fd);
+        if (!written) {
+            std::remove(tmp_path.c_str());
+            return Result<size_t>::error("Write failed: " + tmp_path + ": " + std::strerror(write_errno));
+        }
+
+        // rename() replaces the previous checkpoint atomically, and with the
+        // fdatasync above and the directory fsync below that holds across a
+        // power loss or kernel crash too: the old file or the complete new
+        // one, never a renamed partial write.
+        std::error_code ec;
+        std::filesystem::rename(tmp_path, path, ec);
+        if (ec) {
+            return Result<size_t>::error("Rename to " + path + " failed: " + ec.message());
+        }
+        if (!sync_parent_directory(path)) {
+            return Result<size_t>::error("Cannot sync directory of " + path + ": " + std::strerror(errno));
+        }
+
+        return Result<size_t>::ok(sizeof(header) +
+                                  snapshot.levels.size() * sizeof(SnapshotLevel) +
+                                  snapshot.orders.size() * sizeof(SnapshotOrder));
+    }
+
+    Result<BookSnapshot> load_snapshot(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            return Result<BookSnapshot>::error("Cannot open " + path);
+        }
+
+        SnapshotFileHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            return Result<BookSnapshot>::error("Truncated header: " + path);
+        }
+        if (header.magic != snapshot::MAGIC) {
+            return Result<BookSnapshot>::error("Not a book snapshot: " + path);
+        }
+        if (header.version != snapshot::VERSION) {
+            return Result<BookSnapshot>::error("Unsupported snapshot version " + std::to_string(header.version));
+        }
+
+        // Validate counts against the file size before allocating
+        std::error_code ec;
+        const auto file_size = std::filesystem::file_size(path, ec);
+        const uint64_t max_records = ec ? 0 : (file_size - sizeof(header)) / sizeof(SnapshotOrder);
+        if (header.level_count > max_records || header.order_count > max_records ||
+            sizeof(header) + (header.level_count + header.order_count) * sizeof(SnapshotOrder) != file_size) {
+            return Result<BookSnapshot>::error("Snapshot size mismatch: " + path);
+        }
+
+        BookSnapshot snapshot;
+        snapshot.stock_locate = header.stock_locate;
+        snapshot.symbol = header.symbol;
+        snapshot.last_sequence = header.last_sequence;
+        snapshot.levels.resize(header.level_count);
+        snapshot.orders.resize(header.order_count);
+
+        in.read(reinterpret_cast<char*>(snapshot.levels.data()),
+                static_cast<std::streamsize>(snapshot.levels.size() * sizeof(SnapshotLevel)));
+        in.read(reinterpret_cast<char*>(snapshot.orders.data()),
+                static_cast<std::streamsize>(snapshot.orders.size() * sizeof(SnapshotOrder)));
+        if (!in) {
+            return Result<BookSnapshot>::error("Truncated snapshot: " + path);
+        }
+
+        if (checksum(snapshot.levels, snapshot.orders) != header.checksum) {
+            return Result<BookSnapshot>::error("Snapshot checksum mismatch: " + path);
+        }
+
+        return Result<BookSnapshot>::ok(std::move(snapshot));
+    }
+
+} // namespace hft
@@ -0,0 +1,145 @@
+#include "book/snapshot_writer.hpp"
+#include "itch/messages.hpp"
+#include "network/capture_file.hpp"
+#include "network/moldudp64.hpp"
+#include <filesystem>
+
+namespace hft {
+
+    SnapshotWriter::SnapshotWriter(std::string path)
+        : path_(std::move(path)),
+          thread_([this] { run(); }) {}
+
+    SnapshotWriter::~SnapshotWriter() {
+        stop_.store(true, std::memory_order_release);
+        submitted_.fetch_add(1, std::memory_order_release);
+        submitted_.notify_one();
+        thread_.join();
+    }
+
+    bool SnapshotWriter::try_checkpoint(const OrderBook& book) {
+        // Only this thread moves a buffer out of FREE, so a FREE buffer stays
+        // ours until we publish it.
+        Buffer* target = nullptr;
+        Buffer* other = nullptr;
+        if (buffers_[0].state.load(std::memory_order_acquire) == FREE) {
+            target = &buffers_[0];
+            other = &buffers_[1];
+        } else if (buffers_[1].state.load(std::memory_order_acquire) == FREE) {
+            target = &buffers_[1];
+            other = &buffers_[0];
+        } else {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        book.capture_snapshot(target->snapshot);
+
+        // An older checkpoint still waiting to be written is now stale
+        uint8_t expected = PENDING;
+        if (other->state.compare_exchange_strong(expected, FREE, std::memory_order_acq_rel)) {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        target->state.store(PENDING, std::memory_order_release);
+        submitted_.fetch_add(1, std::memory_order_release);
+        submitted_.notify_one();
+        return true;
+    }
+
+    void SnapshotWriter::flush() const {
+        for (const Buffer& buffer : buffers_) {
+            while (buffer.state.load(std::memory_order_acquire) != FREE) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void SnapshotWriter::run() {
+        uint32_t seen = 0;
+        while (true) {
+            submitted_.wait(seen, std::memory_order_acquire);
+            seen = submitted_.load(std::memory_order_acquire);
+
+            for (Buffer& buffer : buffers_) {
+                uint8_t expected = PENDING;
+                if (!buffer.state.compare_exchange_strong(expected, WRITING, std::memory_order_acq_rel)) {
+                    continue;
+                }
+
+                buffer.snapshot.build_levels();
+                auto result = save_snapshot(buffer.snapshot, path_);
+                if (result) {
+                    written_.fetch_add(1, std::memory_order_relaxed);
+                    last_written_sequence_.store(buffer.snapshot.last_sequence, std::memory_order_release);
+                } else {
+                    failed_.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                buffer.state.store(FREE, std::memory_order_release);
+            }
+
+            if (stop_.load(std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    Result<RecoveryStats> recover_order_book(OrderBook& book,
+                                             const std::string& snapshot_path,
+                                             const std::string& capture_path) {
+        RecoveryStats stats;
+
+        if (std::filesystem::exists(snapshot_path)) {
+            auto snapshot = load_snapshot(snapshot_path);
+            if (!snapshot) {
+                return Result<RecoveryStats>::error(snapshot.error_message);
+            }
+            if (!book.restore_snapshot(snapshot.value)) {
+                return Result<RecoveryStats>::error("Checkpoint does not match book: " + snapshot_path);
+            }
+            stats.checkpoint_sequence = book.last_sequence();
+        }
+
+        network::CaptureReader reader(capture_path);
+        if (!reader.is_open()) {
+            return Result<RecoveryStats>::error("Cannot open capture " + capture_path);
+        }
+
+        std::span<const uint8_t> datagram;
+        while (reader.next(datagram)) {
+            ++stats.packets_read;
+
+            auto packet = network::MoldUDP64PacketView::parse(datagram.data(), datagram.size());
+            if (!packet) {
+                ++stats.parse_errors;
+                continue;
+            }
+
+            for (const network::MessageBlock block : *packet) {
+                if (block.sequence <= book.last_sequence()) {
+                    ++stats.messages_skipped;
+                    continue;
+                }
+                if (block.sequence != book.last_sequence() + 1) {
+                    ++stats.sequence_gaps;
+                }
+
+                // The sequence goes in with the message, so deltas published
+                // during replay carry it (see OrderBook::set_delta_ring)
+                auto parsed = itch::parse_message(block.data, block.length);
+                if (parsed.is_success()) {
+                    book.apply(*parsed.message, block.sequence);
+                    ++stats.messages_applied;
+                } else {
+                    book.set_last_sequence(block.sequence);
+                    ++stats.parse_errors;
+                }
+            }
+        }
+
+        stats.last_sequence = book.last_sequence();
+        return Result<RecoveryStats>::ok(stats);
+    }
+
+} // namespace hft
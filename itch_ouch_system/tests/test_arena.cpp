@@ -0,0 +1,176 @@
+// tests/test_arena.cpp
+//
+// Tests for the per-packet MonotonicArena and the pmr-aware parse paths
+
+#include "common/arena.hpp"
+#include "itch/messages.hpp"
+#include "network/moldudp64.hpp"
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+using namespace hft;
+
+/// Upstream resource that counts what the arena asks of it
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t bytes_outstanding = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        bytes_outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        bytes_outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+/// MoldUDP64 data packet carrying the given ITCH messages
+std::vector<uint8_t> make_packet(uint64_t sequence, const std::vector<std::vector<uint8_t>>& messages) {
+    const char session[] = "ARENA00001";
+    std::vector<uint8_t> packet(session, session + network::protocol::SESSION_ID_LENGTH);
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        packet.push_back(static_cast<uint8_t>(sequence >> shift));
+    }
+    const auto count = static_cast<uint16_t>(messages.size());
+    packet.push_back(static_cast<uint8_t>(count >> 8));
+    packet.push_back(static_cast<uint8_t>(count & 0xFF));
+    for (const auto& msg : messages) {
+        packet.push_back(static_cast<uint8_t>(msg.size() >> 8));
+        packet.push_back(static_cast<uint8_t>(msg.size() & 0xFF));
+        packet.insert(packet.end(), msg.begin(), msg.end());
+    }
+    return packet;
+}
+
+void test_bump_and_reset() {
+    std::cout << "\n=== Test: Bump Allocation and Reset ===\n";
+
+    CountingResource upstream;
+    MonotonicArena arena(1024, &upstream);
+    assert(arena.capacity() == 1024 && arena.used() == 0);
+
+    [[maybe_unused]] void* a = arena.allocate_bytes(3, 1);
+    [[maybe_unused]] void* b = arena.allocate_bytes(8, 8);
+    void* c = arena.allocate(16, 64);  // Through the memory_resource interface
+    assert(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    assert(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+    assert(static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 3);
+    assert(static_cast<std::byte*>(c) >= static_cast<std::byte*>(b) + 8);
+    [[maybe_unused]] const size_t used = arena.used();
+    assert(used >= 3 + 8 + 16);
+    std::cout << "[OK] Allocations are aligned and packed (" << used << " bytes used)\n";
+
+    // Deallocation is a no-op; reset rewinds to the start of the buffer
+    arena.deallocate(c, 16, 64);
+    assert(arena.used() == used);
+    arena.reset();
+    assert(arena.used() == 0 && arena.high_water() == used);
+    assert(arena.allocate_bytes(3, 1) == a);
+    assert(upstream.allocations == 0);
+    std::cout << "[OK] reset() rewinds; buffer reused without touching upstream\n";
+}
+
+void test_overflow() {
+    std::cout << "\n=== Test: Overflow to Upstream ===\n";
+
+    CountingResource upstream;
+    {
+        MonotonicArena arena(256, &upstream);
+        [[maybe_unused]] void* fits = arena.allocate_bytes(200);
+        void* big = arena.allocate_bytes(1000, 32);
+        void* spill = arena.allocate_bytes(100);
+        assert(reinterpret_cast<uintptr_t>(big) % 32 == 0);
+        assert(upstream.allocations == 2 && arena.overflow_count() == 2);
+        std::memset(big, 0xAB, 1000);
+        std::memset(spill, 0xCD, 100);
+        std::cout << "[OK] Requests that do not fit go to upstream\n";
+
+        arena.reset();
+        assert(upstream.deallocations == 2 && upstream.bytes_outstanding == 0);
+        assert(arena.allocate_bytes(200) == fits);
+        std::cout << "[OK] reset() returns overflow blocks to upstream\n";
+
+        (void)arena.allocate_bytes(512);
+    }
+    assert(upstream.allocations == 3 && upstream.bytes_outstanding == 0);
+    std::cout << "[OK] Destructor releases outstanding overflow blocks\n";
+}
+
+void test_pmr_containers() {
+    std::cout << "\n=== Test: std::pmr Containers ===\n";
+
+    CountingResource upstream;
+    MonotonicArena arena(4096, &upstream);
+
+    std::pmr::vector<uint64_t> values(&arena);
+    for (uint64_t i = 0; i < 100; ++i) {
+        values.push_back(i * i);
+    }
+    std::pmr::string text("a string well past the small-string buffer", &arena);
+    assert(values[99] == 99 * 99 && text.size() > 15);
+    assert(arena.used() >= 100 * sizeof(uint64_t) + text.size());
+    assert(upstream.allocations == 0);
+    std::cout << "[OK] Vector growth and long strings served from the arena\n";
+}
+
+void test_parse_with_arena() {
+    std::cout << "\n=== Test: Parsing Into the Arena ===\n";
+
+    std::vector<std::vector<uint8_t>> messages;
+    for (uint8_t i = 0; i < 8; ++i) {
+        messages.push_back(std::vector<uint8_t>(12 + i, 'Z'));  // Not an ITCH type
+    }
+    auto data = make_packet(42, messages);
+
+    CountingResource upstream;
+    MonotonicArena arena(4096, &upstream);
+
+    auto heap = network::MoldUDP64Packet::parse(data.data(), data.size());
+    auto scratch = network::MoldUDP64Packet::parse(data.data(), data.size(), &arena);
+    assert(heap && scratch);
+    assert(scratch->messages.get_allocator().resource() == &arena);
+    assert(scratch->messages.size() == heap->messages.size());
+    for (size_t i = 0; i < heap->messages.size(); ++i) {
+        assert(scratch->messages[i].data == heap->messages[i].data);
+        assert(scratch->messages[i].sequence == heap->messages[i].sequence);
+    }
+    assert(arena.used() >= 8 * sizeof(network::MessageBlock));
+    std::cout << "[OK] MoldUDP64Packet blocks allocated from the arena\n";
+
+    // Unknown message types: the error detail is built in the arena
+    [[maybe_unused]] const size_t before = arena.used();
+    auto expected = itch::parse_message(scratch->messages[0].data, scratch->messages[0].length);
+    auto actual = itch::parse_message(scratch->messages[0].data, scratch->messages[0].length, &arena);
+    assert(!actual.is_success() && actual.error_code == expected.error_code);
+    assert(actual.error_detail == expected.error_detail);
+    assert(actual.error_detail.get_allocator().resource() == &arena);
+    assert(arena.used() > before);
+    assert(upstream.allocations == 0);
+    std::cout << "[OK] ParseResult error detail allocated from the arena: "
+              << actual.error_detail << "\n";
+
+    arena.reset();
+    assert(arena.used() == 0);
+}
+
+int main() {
+    test_bump_and_reset();
+    test_overflow();
+    test_pmr_containers();
+    test_parse_with_arena();
+
+    std::cout << "\nAll arena tests passed!\n";
+    return 0;
+}
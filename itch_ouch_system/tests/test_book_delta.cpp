@@ -0,0 +1,232 @@
+// tests/test_book_delta.cpp
+//
+// Tests for OrderBook delta publication and consumer-side L2 rebuild
+
+#include "book/order_book.hpp"
+#include "book/book_delta.hpp"
+#include "itch/messages.hpp"
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace hft;
+using namespace hft::itch;
+
+AddOrder create_add_order(uint64_t ref, char side, uint32_t shares, uint32_t price) {
+    AddOrder msg{};
+    msg.order_reference = ref;
+    msg.buy_sell_indicator = side;
+    msg.shares = shares;
+    std::memcpy(msg.symbol.data(), "MSFT    ", 8);
+    msg.price = price;
+    return msg;
+}
+
+constexpr size_t DELTA_RING_CAPACITY = 8191;
+
+std::vector<BookDelta> drain(BookDeltaRing& ring) {
+    std::vector<BookDelta> out;
+    while (auto delta = ring.try_pop()) {
+        out.push_back(*delta);
+    }
+    return out;
+}
+
+// Consumer rebuild must match the producer's own aggregation exactly
+void assert_books_match(const OrderBook& book, const L2Book& l2) {
+    BookSnapshot snapshot;
+    book.capture_snapshot(snapshot);
+    snapshot.build_levels();
+
+    auto levels = l2.levels();
+    assert(levels.size() == snapshot.levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        assert(levels[i].side == snapshot.levels[i].side);
+        assert(levels[i].price == snapshot.levels[i].price);
+        assert(levels[i].quantity == snapshot.levels[i].quantity);
+        assert(levels[i].order_count == snapshot.levels[i].order_count);
+    }
+}
+
+void test_delta_ring() {
+    std::cout << "\n=== Test: BookDeltaRing ===\n";
+
+    auto ring = std::make_unique<BookDeltaRing>();
+    assert(ring->empty());
+    [[maybe_unused]] bool ok = false;
+    size_t pushed = 0;
+    for (;;) {
+        BookDelta delta;
+        delta.sequence = pushed;
+        if (!ring->try_push(delta)) {
+            break;
+        }
+        ++pushed;
+    }
+    assert(pushed == DELTA_RING_CAPACITY);  // RingBuffer keeps one slot empty
+    assert(ring->full());
+
+    for (uint64_t i = 0; i < pushed; ++i) {
+        [[maybe_unused]] auto delta = ring->try_pop();
+        assert(delta && delta->sequence == i);
+    }
+    ok = ring->try_pop().has_value();
+    assert(!ok);
+
+    // Wrap-around
+    for (uint64_t i = 0; i < 10; ++i) {
+        BookDelta delta;
+        delta.sequence = i;
+        ok = ring->try_push(delta);
+        assert(ok);
+        [[maybe_unused]] auto popped = ring->try_pop();
+        assert(popped && popped->sequence == i);
+    }
+    std::cout << "[OK] FIFO order, full/empty and wrap-around\n";
+}
+
+void test_deltas_rebuild_l2() {
+    std::cout << "\n=== Test: Deltas Rebuild L2 ===\n";
+
+    BookDeltaRing ring;
+    OrderBook book(1, "MSFT    ");
+    book.set_delta_ring(&ring);
+    L2Book l2;
+
+    // --- Unbatched: one message, one delta, stamped with its own sequence ---
+    book.apply(ITCHMessage{create_add_order(101, 'B', 100, 1500000)}, 1);
+    auto deltas = drain(ring);
+    assert(deltas.size() == 1);
+    assert(deltas[0].side == Side::BUY);
+    assert(deltas[0].price == 1500000);
+    assert(deltas[0].quantity == 100);
+    assert(deltas[0].order_count == 1);
+    assert(deltas[0].stock_locate == 1);
+    assert(deltas[0].sequence == 1);
+    assert(deltas[0].end_of_batch());
+    for (const auto& d : deltas) l2.apply(d);
+    assert(l2.best_bid()->quantity == 100);
+    assert(l2.consistent_sequence() == 1);
+    std::cout << "[OK] Unbatched update emits one delta\n";
+
+    // --- Batched: level touched three times emits once ---
+    book.begin_batch();
+    book.add_order(create_add_order(102, 'B', 50, 1500000));
+    book.add_order(create_add_order(103, 'B', 25, 1500000));
+    OrderCancel cancel{};
+    cancel.order_reference = 101;
+    cancel.cancelled_shares = 30;
+    book.cancel_order(cancel);
+    book.add_order(create_add_order(201, 'S', 70, 1500500));
+    assert(ring.empty());  // Nothing published until the batch ends
+    [[maybe_unused]] const bool published = book.end_batch(5);
+    assert(published);
+
+    deltas = drain(ring);
+    assert(deltas.size() == 2);
+    assert(deltas[0].side == Side::BUY && deltas[0].quantity == 145 && deltas[0].order_count == 3);
+    assert(!deltas[0].end_of_batch());
+    assert(deltas[1].side == Side::SELL && deltas[1].quantity == 70);
+    assert(deltas[1].end_of_batch() && deltas[1].sequence == 5);
+    for (const auto& d : deltas) l2.apply(d);
+    assert(l2.consistent_sequence() == 5);
+    assert_books_match(book, l2);
+    std::cout << "[OK] Batch coalesced four updates into two deltas\n";
+
+    // --- Level removal and replace ---
+    OrderDelete del{};
+    del.order_reference = 201;
+    book.apply(ITCHMessage{del}, 6);
+    [[maybe_unused]] size_t applied = l2.drain(ring);
+    assert(applied == 1);
+    assert(!l2.best_ask().has_value());
+    assert(l2.consistent_sequence() == 6);
+    std::cout << "[OK] Emptied level removed from consumer book\n";
+
+    OrderReplace replace{};
+    replace.original_order_reference = 102;
+    replace.new_order_reference = 104;
+    replace.shares = 80;
+    replace.price = 1500100;
+    book.apply(ITCHMessage{replace}, 7);
+    applied = l2.drain(ring);
+    assert(applied == 2);
+    assert(l2.consistent_sequence() == 7);
+    assert(l2.best_bid()->price == 1500100);
+    assert(l2.depth(Side::BUY) == 2);
+    assert_books_match(book, l2);
+    std::cout << "[OK] Replace emits old and new level\n";
+
+    assert(book.delta_overflows() == 0);
+}
+
+void test_ring_full_converges() {
+    std::cout << "\n=== Test: Full Ring Converges ===\n";
+
+    // Leave two free slots: the batch below needs five, so the book sees a
+    // two-slot ring (filler deltas occupy the rest until the consumer drains)
+    constexpr uint16_t FILLER_LOCATE = 0xFFFF;
+    auto ring = std::make_unique<BookDeltaRing>();
+    for (size_t i = 0; i + 2 < DELTA_RING_CAPACITY; ++i) {
+        BookDelta filler;
+        filler.stock_locate = FILLER_LOCATE;
+        [[maybe_unused]] bool pushed = ring->try_push(filler);
+        assert(pushed);
+    }
+
+    OrderBook book(1, "MSFT    ");
+    book.set_delta_ring(ring.get());
+    L2Book l2;
+    auto consume = [&] {
+        size_t real = 0;
+        for (const BookDelta& d : drain(*ring)) {
+            if (d.stock_locate != FILLER_LOCATE) {
+                l2.apply(d);
+                ++real;
+            }
+        }
+        return real;
+    };
+
+    // --- Batch of five levels into two free slots ---
+    book.begin_batch();
+    book.apply(ITCHMessage{create_add_order(1, 'B', 100, 1500000)}, 1);
+    book.apply(ITCHMessage{create_add_order(2, 'B', 200, 1499900)}, 2);
+    book.apply(ITCHMessage{create_add_order(3, 'B', 300, 1499800)}, 3);
+    book.apply(ITCHMessage{create_add_order(4, 'S', 400, 1500100)}, 4);
+    book.apply(ITCHMessage{create_add_order(5, 'S', 500, 1500200)}, 5);
+    [[maybe_unused]] bool published = book.end_batch(5);
+    assert(!published);
+    assert(book.delta_overflows() == 1);
+
+    // The consumer got part of the batch and no END_OF_BATCH: not consistent yet
+    [[maybe_unused]] size_t applied = consume();
+    assert(applied == 2);
+    assert(l2.consistent_sequence() == 0);
+    std::cout << "[OK] Overflow published a partial batch without END_OF_BATCH\n";
+
+    // --- Next message: leftover levels go out with their latest state ---
+    OrderCancel cancel{};
+    cancel.order_reference = 5;  // Ask level 1500200 is still pending
+    cancel.cancelled_shares = 150;
+    book.apply(ITCHMessage{cancel}, 6);
+    applied = consume();
+    assert(applied == 3);  // Three leftover levels; the cancel's level is one of them
+    assert(l2.consistent_sequence() == 6);
+    assert(l2.best_ask()->price == 1500100);
+    assert(l2.depth(Side::BUY) == 3 && l2.depth(Side::SELL) == 2);
+    assert_books_match(book, l2);
+    assert(book.delta_overflows() == 1);
+    std::cout << "[OK] Leftover levels retried; consumer converged at sequence 6\n";
+}
+
+int main() {
+    test_delta_ring();
+    test_deltas_rebuild_l2();
+    test_ring_full_converges();
+
+    std::cout << "\nAll book delta tests passed!\n";
+    return 0;
+}
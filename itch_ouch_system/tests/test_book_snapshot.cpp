@@ -0,0 +1,241 @@
+// tests/test_book_snapshot.cpp
+//
+// Tests for order-book checkpoints and capture-tail recovery
+
+#include "book/order_book.hpp"
+#include "book/snapshot.hpp"
+#include "book/snapshot_writer.hpp"
+#include "network/capture_file.hpp"
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using namespace hft;
+
+namespace fs = std::filesystem;
+
+// Append `value` as `bytes` big-endian bytes
+void put_be(std::vector<uint8_t>& out, uint64_t value, int bytes) {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+    }
+}
+
+// Common ITCH prefix: type, stock locate, tracking number, 6-byte timestamp
+std::vector<uint8_t> itch_prefix(char type, uint16_t stock_locate) {
+    std::vector<uint8_t> msg;
+    msg.push_back(static_cast<uint8_t>(type));
+    put_be(msg, stock_locate, 2);
+    put_be(msg, 0, 2);
+    put_be(msg, 34200000000000ULL, 6);
+    return msg;
+}
+
+std::vector<uint8_t> build_add_order(uint64_t ref, char side, uint32_t shares, uint32_t price) {
+    auto msg = itch_prefix('A', 1);
+    put_be(msg, ref, 8);
+    msg.push_back(static_cast<uint8_t>(side));
+    put_be(msg, shares, 4);
+    for (char c : std::string("AAPL    ")) msg.push_back(static_cast<uint8_t>(c));
+    put_be(msg, price, 4);
+    return msg;
+}
+
+std::vector<uint8_t> build_order_executed(uint64_t ref, uint32_t shares) {
+    auto msg = itch_prefix('E', 1);
+    put_be(msg, ref, 8);
+    put_be(msg, shares, 4);
+    put_be(msg, 1, 8);  // Match number
+    return msg;
+}
+
+std::vector<uint8_t> build_order_delete(uint64_t ref) {
+    auto msg = itch_prefix('D', 1);
+    put_be(msg, ref, 8);
+    return msg;
+}
+
+// Wrap one ITCH message in a MoldUDP64 datagram
+std::vector<uint8_t> build_datagram(uint64_t sequence, const std::vector<uint8_t>& message) {
+    std::vector<uint8_t> packet;
+    for (char c : std::string("SESSION001")) packet.push_back(static_cast<uint8_t>(c));
+    put_be(packet, sequence, 8);
+    put_be(packet, 1, 2);
+    put_be(packet, message.size(), 2);
+    packet.insert(packet.end(), message.begin(), message.end());
+    return packet;
+}
+
+// Parse a datagram and apply it to `book`, as a feed handler would
+void feed(OrderBook& book, const std::vector<uint8_t>& datagram) {
+    auto packet = network::MoldUDP64PacketView::parse(datagram.data(), datagram.size());
+    assert(packet.has_value());
+    for (const network::MessageBlock block : *packet) {
+        auto parsed = itch::parse_message(block.data, block.length);
+        assert(parsed.is_success());
+        book.apply(*parsed.message, block.sequence);
+    }
+}
+
+void test_snapshot_round_trip() {
+    std::cout << "\n=== Test: Snapshot Round Trip ===\n";
+
+    const std::string path = (fs::temp_directory_path() / "hft_test_snapshot_round_trip.bin").string();
+
+    BookSnapshot snapshot;
+    snapshot.stock_locate = 7;
+    std::memcpy(snapshot.symbol.data(), "MSFT    ", 8);
+    snapshot.last_sequence = 12345;
+    snapshot.orders.push_back({1, 1500000, 100, Side::BUY});
+    snapshot.orders.push_back({2, 1500100, 50, Side::BUY});
+    snapshot.orders.push_back({3, 1500000, 25, Side::BUY});
+    snapshot.orders.push_back({4, 1500500, 75, Side::SELL});
+    snapshot.build_levels();
+
+    // Bids best-first, then asks best-first
+    assert(snapshot.levels.size() == 3);
+    assert(snapshot.levels[0].price == 1500100 && snapshot.levels[0].quantity == 50);
+    assert(snapshot.levels[1].price == 1500000 && snapshot.levels[1].quantity == 125);
+    assert(snapshot.levels[1].order_count == 2);
+    assert(snapshot.levels[2].side == Side::SELL && snapshot.levels[2].quantity == 75);
+    std::cout << "[OK] Levels aggregated from orders\n";
+
+    auto saved = save_snapshot(snapshot, path);
+    assert(saved);
+    assert(!fs::exists(path + ".tmp"));
+
+    auto loaded = load_snapshot(path);
+    assert(loaded);
+    assert(loaded.value.stock_locate == 7);
+    assert(loaded.value.symbol == snapshot.symbol);
+    assert(loaded.value.last_sequence == 12345);
+    assert(loaded.value.levels.size() == 3);
+    assert(loaded.value.orders.size() == 4);
+    assert(loaded.value.orders[1].order_reference == snapshot.orders[1].order_reference);
+    std::cout << "[OK] Loaded snapshot matches saved snapshot\n";
+
+    fs::remove(path);
+}
+
+void test_snapshot_rejects_corruption() {
+    std::cout << "\n=== Test: Snapshot Rejects Corruption ===\n";
+
+    const std::string path = (fs::temp_directory_path() / "hft_test_snapshot_corrupt.bin").string();
+
+    BookSnapshot snapshot;
+    std::memcpy(snapshot.symbol.data(), "MSFT    ", 8);
+    snapshot.orders.push_back({1, 1500000, 100, Side::BUY});
+    snapshot.build_levels();
+    auto saved = save_snapshot(snapshot, path);
+    assert(saved);
+
+    // Flip one byte in the order section
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(sizeof(SnapshotFileHeader) + sizeof(SnapshotLevel) + 8));
+        file.put('\x7F');
+    }
+    assert(!load_snapshot(path));
+    std::cout << "[OK] Checksum mismatch detected\n";
+
+    // Truncate the file
+    fs::resize_file(path, sizeof(SnapshotFileHeader) + 4);
+    assert(!load_snapshot(path));
+    std::cout << "[OK] Truncated file rejected\n";
+
+    assert(!load_snapshot(path + ".missing"));
+    std::cout << "[OK] Missing file rejected\n";
+
+    fs::remove(path);
+}
+
+void test_checkpoint_and_tail_replay() {
+    std::cout << "\n=== Test: Checkpoint + Tail Replay ===\n";
+
+    const std::string snapshot_path = (fs::temp_directory_path() / "hft_test_recovery_snapshot.bin").string();
+    const std::string capture_path = (fs::temp_directory_path() / "hft_test_recovery_capture.bin").string();
+    fs::remove(snapshot_path);
+    fs::remove(capture_path);
+
+    std::vector<std::vector<uint8_t>> datagrams = {
+        build_datagram(1, build_add_order(1001, 'B', 100, 1500000)),
+        build_datagram(2, build_add_order(1002, 'B', 200, 1499500)),
+        build_datagram(3, build_add_order(2001, 'S', 100, 1500500)),
+        build_datagram(4, build_add_order(2002, 'S', 200, 1501000)),
+        // --- checkpoint here ---
+        build_datagram(5, build_order_executed(2001, 100)),
+        build_datagram(6, build_order_delete(1001)),
+        build_datagram(7, build_add_order(1003, 'B', 50, 1499900)),
+    };
+
+    OrderBook live(1, "AAPL    ");
+    {
+        SnapshotWriter writer(snapshot_path);
+        network::CaptureWriter capture(capture_path);
+        assert(capture.is_open());
+
+        for (size_t i = 0; i < datagrams.size(); ++i) {
+            [[maybe_unused]] const bool captured = capture.write(datagrams[i].data(), datagrams[i].size());
+            assert(captured);
+            feed(live, datagrams[i]);
+            if (live.last_sequence() == 4) {
+                [[maybe_unused]] const bool queued = writer.try_checkpoint(live);
+                assert(queued);
+            }
+        }
+        capture.flush();
+        writer.flush();
+
+        assert(writer.checkpoints_written() == 1);
+        assert(writer.checkpoints_failed() == 0);
+        assert(writer.last_written_sequence() == 4);
+    }
+    std::cout << "[OK] Checkpoint written in background at sequence 4\n";
+
+    OrderBook recovered(1, "AAPL    ");
+    auto result = recover_order_book(recovered, snapshot_path, capture_path);
+    assert(result);
+    [[maybe_unused]] const RecoveryStats& stats = result.value;
+    assert(stats.checkpoint_sequence == 4);
+    assert(stats.packets_read == 7);
+    assert(stats.messages_skipped == 4);
+    assert(stats.messages_applied == 3);
+    assert(stats.sequence_gaps == 0);
+    assert(stats.last_sequence == 7);
+    std::cout << "[OK] Replayed only the tail (3 of 7 messages)\n";
+
+    [[maybe_unused]] TopOfBook expected = live.get_top_of_book();
+    [[maybe_unused]] TopOfBook actual = recovered.get_top_of_book();
+    assert(actual.bid_price == expected.bid_price);
+    assert(actual.bid_quantity == expected.bid_quantity);
+    assert(actual.ask_price == expected.ask_price);
+    assert(actual.ask_quantity == expected.ask_quantity);
+    assert(actual.bid_price == 1499900 && actual.bid_quantity == 50);
+    assert(actual.ask_price == 1501000 && actual.ask_quantity == 200);
+    assert(recovered.last_sequence() == live.last_sequence());
+    std::cout << "[OK] Recovered book matches live book\n";
+
+    // A checkpoint for another instrument must not be applied
+    BookSnapshot foreign;
+    foreign.stock_locate = 2;
+    std::memcpy(foreign.symbol.data(), "MSFT    ", 8);
+    [[maybe_unused]] const bool restored = recovered.restore_snapshot(foreign);
+    assert(!restored);
+    assert(recovered.last_sequence() == 0);
+    std::cout << "[OK] Foreign checkpoint rejected\n";
+
+    fs::remove(snapshot_path);
+    fs::remove(capture_path);
+}
+
+int main() {
+    test_snapshot_round_trip();
+    test_snapshot_rejects_corruption();
+    test_checkpoint_and_tail_replay();
+
+    std::cout << "\nAll book snapshot tests passed!\n";
+    return 0;
+}
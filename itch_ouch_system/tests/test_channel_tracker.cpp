@@ -0,0 +1,176 @@
+// tests/test_channel_tracker.cpp
+//
+// Tests for multi-channel MoldUDP64 sequence tracking
+
+#include "network/channel_tracker.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <cstring>
+
+using namespace hft::network;
+
+// Build a MoldUDP64 packet with `count` 3-byte messages (count 0 = heartbeat,
+// 0xFFFF = end-of-session)
+std::vector<uint8_t> create_test_packet(const char* session, uint64_t sequence, uint16_t count) {
+    std::vector<uint8_t> packet;
+
+    for (size_t i = 0; i < 10; ++i) {
+        packet.push_back(i < std::strlen(session) ? session[i] : ' ');
+    }
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        packet.push_back((sequence >> shift) & 0xFF);
+    }
+    packet.push_back((count >> 8) & 0xFF);
+    packet.push_back(count & 0xFF);
+
+    if (count != 0 && count != 0xFFFF) {
+        for (uint16_t i = 0; i < count; ++i) {
+            packet.push_back(0);
+            packet.push_back(3);
+            packet.push_back('S');
+            packet.push_back(0);
+            packet.push_back(static_cast<uint8_t>(i));
+        }
+    }
+    return packet;
+}
+
+MoldUDP64PacketView parse(const std::vector<uint8_t>& data) {
+    return MoldUDP64PacketView::parse(data.data(), data.size()).value();
+}
+
+void test_channels_are_independent() {
+    std::cout << "\n=== Test: Channels Are Independent ===\n";
+
+    MultiChannelSequenceTracker<8> tracker;
+    assert(tracker.active_channels().none());
+
+    auto a1 = create_test_packet("CHANA00001", 100, 2);
+    auto b1 = create_test_packet("CHANB00001", 5000, 1);
+    [[maybe_unused]] auto a1_info = tracker.process_packet(0, parse(a1));
+    [[maybe_unused]] auto b1_info = tracker.process_packet(3, parse(b1));
+    assert(!a1_info.has_gap);
+    assert(!b1_info.has_gap);
+
+    assert(tracker.expected_sequence(0) == 102);
+    assert(tracker.expected_sequence(3) == 5001);
+    assert(tracker.channel(0).current_session() == "CHANA00001");
+    assert(tracker.channel(3).current_session() == "CHANB00001");
+    assert(tracker.active_channels().count() == 2);
+
+    // Gap on channel 3 does not affect channel 0
+    auto b2 = create_test_packet("CHANB00001", 5010, 1);
+    [[maybe_unused]] auto gap = tracker.process_packet(3, parse(b2));
+    assert(gap.has_gap);
+    assert(gap.gap_start == 5001);
+    assert(gap.gap_count == 9);
+
+    auto a2 = create_test_packet("CHANA00001", 102, 1);
+    [[maybe_unused]] auto a2_info = tracker.process_packet(0, parse(a2));
+    assert(!a2_info.has_gap);
+
+    assert(tracker.stats(3).gaps == 1);
+    assert(tracker.stats(3).messages_missed == 9);
+    assert(tracker.stats(0).gaps == 0);
+    assert(tracker.stats(0).packets == 2);
+
+    std::cout << "[OK] Per-channel gap state is isolated\n";
+}
+
+void test_per_channel_session_rollover() {
+    std::cout << "\n=== Test: Per-Channel Session Rollover ===\n";
+
+    MultiChannelSequenceTracker<4> tracker;
+
+    auto a1 = create_test_packet("SESSA00001", 100, 1);
+    auto b1 = create_test_packet("SESSB00001", 200, 1);
+    (void)tracker.process_packet(0, parse(a1));
+    (void)tracker.process_packet(1, parse(b1));
+
+    // Channel 1 rolls to a new session; channel 0 keeps its sequence space
+    auto b2 = create_test_packet("SESSB00002", 1, 1);
+    [[maybe_unused]] auto info = tracker.process_packet(1, parse(b2));
+    assert(info.session_changed);
+    assert(!info.has_gap);
+    assert(tracker.expected_sequence(1) == 2);
+    assert(tracker.expected_sequence(0) == 101);
+    assert(tracker.stats(1).session_changes == 1);
+    assert(tracker.stats(0).session_changes == 0);
+
+    std::cout << "[OK] Session rollover detected per channel\n";
+}
+
+void test_end_of_session_across_channels() {
+    std::cout << "\n=== Test: End-of-Session Across Channels ===\n";
+
+    MultiChannelSequenceTracker<4> tracker;
+    assert(!tracker.all_ended());  // No active channels yet
+
+    auto a1 = create_test_packet("EOSA000001", 10, 1);
+    auto b1 = create_test_packet("EOSB000001", 20, 1);
+    (void)tracker.process_packet(0, parse(a1));
+    (void)tracker.process_packet(2, parse(b1));
+
+    auto a_eos = create_test_packet("EOSA000001", 11, 0xFFFF);
+    (void)tracker.process_packet(0, parse(a_eos));
+    assert(tracker.ended_channels().count() == 1);
+    assert(!tracker.all_ended());  // Channel 2 still open
+
+    auto b_eos = create_test_packet("EOSB000001", 21, 0xFFFF);
+    (void)tracker.process_packet(2, parse(b_eos));
+    assert(tracker.all_ended());
+
+    tracker.reset(2);
+    assert(!tracker.channel(2).is_initialized());
+    assert(tracker.stats(2).packets == 0);
+    assert(tracker.all_ended());  // Only channel 0 active now, and it ended
+
+    tracker.reset();
+    assert(tracker.active_channels().none());
+
+    std::cout << "[OK] Feed ends only when every active channel has ended\n";
+}
+
+void test_accepts_all_packet_types() {
+    std::cout << "\n=== Test: Accepts All Packet Types ===\n";
+
+    MultiChannelSequenceTracker<2> tracker;
+    auto data = create_test_packet("TYPES00001", 1, 3);
+
+    auto packet = MoldUDP64Packet::parse(data.data(), data.size()).value();
+    (void)tracker.process_packet(0, packet);
+    assert(tracker.expected_sequence(0) == 4);
+
+    MoldUDP64InlinePacket inline_packet;
+    [[maybe_unused]] const bool parsed = inline_packet.parse(data.data(), data.size());
+    assert(parsed);
+    (void)tracker.process_packet(1, inline_packet);
+    (void)tracker.process_packet(1, inline_packet.header);  // Duplicate
+    assert(tracker.stats(1).out_of_order == 1);
+
+    std::cout << "[OK] Vector, view, inline packet and raw header accepted\n";
+}
+
+int main() {
+    try {
+        std::cout << "================================================\n";
+        std::cout << "Multi-Channel Sequence Tracker Test Suite\n";
+        std::cout << "================================================\n";
+
+        test_channels_are_independent();
+        test_per_channel_session_rollover();
+        test_end_of_session_across_channels();
+        test_accepts_all_packet_types();
+
+        std::cout << "\n================================================\n";
+        std::cout << "[PASS] ALL CHANNEL TRACKER TESTS PASSED!\n";
+        std::cout << "================================================\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << "\n[FAIL] Test failed: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+// tests/test_mapped_memory.cpp
+//
+// Tests for huge-page / pre-faulted backing memory and the mapped order book
+
+#include "common/mapped_memory.hpp"
+#include "book/order_book.hpp"
+#include "itch/messages.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace hft;
+using namespace hft::itch;
+
+bool all_zero(const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    return std::all_of(bytes, bytes + size, [](uint8_t b) { return b == 0; });
+}
+
+void test_region_options() {
+    std::cout << "\n=== Test: MappedRegion Options ===\n";
+
+    // Small region: plain pages, rounded to a page
+    MappedRegion small(100, {HugePages::NONE, true, false});
+    assert(small.data() != nullptr);
+    assert(small.size() == MappedRegion::PAGE_SIZE);
+    assert(reinterpret_cast<uintptr_t>(small.data()) % MappedRegion::PAGE_SIZE == 0);
+    assert(all_zero(small.data(), small.size()));
+    std::cout << "[OK] Small region is page aligned and zeroed\n";
+
+    // Large THP region: 2 MiB aligned so huge pages can back all of it
+    const size_t bytes = 3 * MappedRegion::HUGE_PAGE_SIZE + 1;
+    MappedRegion large(bytes, {HugePages::TRANSPARENT, true, false});
+    assert(large.size() == 4 * MappedRegion::HUGE_PAGE_SIZE);
+    assert(reinterpret_cast<uintptr_t>(large.data()) % MappedRegion::HUGE_PAGE_SIZE == 0);
+    std::memset(large.data(), 0xAB, large.size());
+    std::cout << "[OK] THP region is 2 MiB aligned and writable (huge pages: "
+              << (large.huge_pages() == HugePages::TRANSPARENT ? "advised" : "unavailable") << ")\n";
+
+    // Explicit huge pages and mlock degrade instead of failing
+    MappedRegion pinned(MappedRegion::HUGE_PAGE_SIZE, {HugePages::EXPLICIT, true, true});
+    assert(pinned.data() != nullptr);
+    assert(all_zero(pinned.data(), pinned.size()));
+    std::cout << "[OK] HUGETLB + mlock region usable (hugetlb: "
+              << (pinned.huge_pages() == HugePages::EXPLICIT ? "yes" : "fell back")
+              << ", locked: " << (pinned.locked() ? "yes" : "no") << ")\n";
+
+    // Move transfers ownership
+    [[maybe_unused]] void* data = large.data();
+    MappedRegion moved(std::move(large));
+    assert(moved.data() == data);
+    assert(large.data() == nullptr);
+    MappedRegion assigned;
+    assigned = std::move(moved);
+    assert(assigned.data() == data && moved.data() == nullptr);
+    std::cout << "[OK] Move construction and assignment transfer the mapping\n";
+}
+
+void test_allocator() {
+    std::cout << "\n=== Test: MappedAllocator ===\n";
+
+    MappedAllocator<PriceLevel> mapped({HugePages::TRANSPARENT, true, false});
+    MappedAllocator<PriceLevel> heap;
+    assert(!(mapped == heap));
+    assert(mapped == MappedAllocator<uint64_t>(mapped));
+
+    // Large allocation: its own 2 MiB-aligned mapping, zeroed
+    const size_t levels = MappedRegion::HUGE_PAGE_SIZE / sizeof(PriceLevel) * 2;
+    PriceLevel* ladder = mapped.allocate(levels);
+    assert(reinterpret_cast<uintptr_t>(ladder) % MappedRegion::HUGE_PAGE_SIZE == 0);
+    assert(all_zero(ladder, levels * sizeof(PriceLevel)));
+    ladder[levels - 1].quantity = 7;
+    mapped.deallocate(ladder, levels);
+    std::cout << "[OK] Large allocation mapped, aligned and released\n";
+
+    // Containers work with both small (heap) and large (mapped) allocations
+    std::vector<PriceLevel, MappedAllocator<PriceLevel>> vec(mapped);
+    for (size_t i = 0; i < levels; ++i) {
+        vec.push_back({static_cast<Price>(i), static_cast<Quantity>(i), 1});
+    }
+    assert(vec.size() == levels && vec.back().price == static_cast<Price>(levels - 1));
+    std::cout << "[OK] Vector grows from heap to mapped storage\n";
+}
+
+void test_mapped_order_book() {
+    std::cout << "\n=== Test: OrderBook on Mapped Memory ===\n";
+
+    // One book only: each holds two full price ladders, slow to fill in Debug
+    OrderBook book(1, "MSFT    ", BackingOptions{HugePages::TRANSPARENT, true, false}, 1 << 16);
+
+    // Odd references bid below 1,500,000, even ones offer above 1,600,000
+    for (uint64_t ref = 1; ref <= 60; ++ref) {
+        AddOrder msg{};
+        msg.order_reference = ref;
+        msg.buy_sell_indicator = (ref % 2) ? 'B' : 'S';
+        msg.shares = 100;
+        std::memcpy(msg.symbol.data(), "MSFT    ", 8);
+        msg.price = (ref % 2) ? 1'500'000 - static_cast<uint32_t>(ref) : 1'600'000 + static_cast<uint32_t>(ref);
+        book.add_order(msg);
+    }
+    // Delete 1, 4, 7, ...: removes the best bid (ref 1), keeps the best ask (ref 2)
+    for (uint64_t ref = 1; ref <= 60; ref += 3) {
+        OrderDelete msg{};
+        msg.order_reference = ref;
+        book.delete_order(msg);
+    }
+
+    [[maybe_unused]] TopOfBook top = book.get_top_of_book();
+    assert(top.bid_price == 1'500'000 - 3 && top.bid_quantity == 100);
+    assert(top.ask_price == 1'600'000 + 2 && top.ask_quantity == 100);
+
+    // Surviving bids, best first: odd references not of the form 3k+1
+    [[maybe_unused]] constexpr uint64_t expected_refs[] = {3, 5, 9, 11, 15, 17, 21, 23, 27, 29};
+    PriceLevel depth[10];
+    [[maybe_unused]] size_t n = book.get_depth(Side::BUY, depth, 10);
+    assert(n == 10);
+    for (size_t i = 0; i < n; ++i) {
+        assert(depth[i].price == static_cast<Price>(1'500'000 - expected_refs[i]));
+        assert(depth[i].quantity == 100 && depth[i].order_count == 1);
+    }
+    std::cout << "[OK] Mapped book holds the expected levels after adds and deletes\n";
+}
+
+int main() {
+    test_region_options();
+    test_allocator();
+    test_mapped_order_book();
+
+    std::cout << "\nAll mapped memory tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,193 @@
+// tests/test_market_data_bus.cpp
+//
+// Tests for the shared-memory market data bus
+
+#include "book/market_data_bus.hpp"
+#include "book/order_book.hpp"
+#include "itch/messages.hpp"
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace hft;
+
+// Unique per process so parallel test runs don't collide
+std::string bus_name(const char* suffix) {
+    return "/hft_test_bus_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+void test_attach_and_discover() {
+    std::cout << "\n=== Test: Attach and Discover ===\n";
+
+    const std::string name = bus_name("discover");
+    [[maybe_unused]] bool attached = MarketDataBusReader::attach(name).has_value();
+    assert(!attached);
+    std::cout << "[OK] Attach to missing segment fails\n";
+
+    auto writer = MarketDataBusWriter::create(name, 4);
+    assert(writer.has_value());
+
+    auto reader = MarketDataBusReader::attach(name);
+    assert(reader.has_value());
+    assert(reader->state() == bus::State::LIVE);
+    assert(reader->symbol_count() == 0);
+
+    // Symbols added after attach become visible without re-attaching
+    [[maybe_unused]] auto aapl = writer->add_symbol(1, "AAPL    ");
+    [[maybe_unused]] auto msft = writer->add_symbol(2, "MSFT");
+    assert(aapl == 0u);
+    assert(msft == 1u);
+    assert(reader->symbol_count() == 2);
+    assert(reader->find("MSFT    ") == 1u);
+    assert(reader->find(uint16_t{1}) == 0u);
+    assert(reader->symbol(0) == "AAPL");
+    assert(reader->stock_locate(1) == 2);
+    assert(!reader->find("TSLA").has_value());
+    std::cout << "[OK] Symbols discovered through the directory\n";
+
+    [[maybe_unused]] auto goog = writer->add_symbol(3, "GOOG");
+    [[maybe_unused]] auto amzn = writer->add_symbol(4, "AMZN");
+    [[maybe_unused]] auto tsla = writer->add_symbol(5, "TSLA");
+    assert(goog && amzn);
+    assert(!tsla.has_value());
+    std::cout << "[OK] Directory full rejected\n";
+
+    TopOfBook top{1500000, 100, 1500100, 200};
+    [[maybe_unused]] uint64_t version_before = reader->top_version(1);
+    writer->publish_top(1, top);
+    assert(reader->top_version(1) == version_before + 1);
+    [[maybe_unused]] auto read = reader->read_top(1);
+    assert(read.has_value());
+    assert(read->bid_price == 1500000 && read->ask_quantity == 200);
+    std::cout << "[OK] Top-of-book visible through reader mapping\n";
+
+    writer.reset();
+    assert(reader->state() == bus::State::CLOSED);
+    attached = MarketDataBusReader::attach(name).has_value();
+    assert(!attached);
+    std::cout << "[OK] Writer shutdown visible to attached readers\n";
+
+    reader->detach();
+}
+
+void test_cross_process_reader() {
+    std::cout << "\n=== Test: Cross-Process Reader ===\n";
+
+    const std::string name = bus_name("fork");
+    auto writer = MarketDataBusWriter::create(name, 2);
+    assert(writer.has_value());
+    uint32_t slot = writer->add_symbol(7, "MSFT").value();
+
+    pid_t child = fork();
+    assert(child >= 0);
+    if (child == 0) {
+        // Child: attach by name and wait for the final update
+        auto reader = MarketDataBusReader::attach(name);
+        if (!reader) _exit(2);
+        auto found = reader->find("MSFT");
+        if (!found) _exit(3);
+        for (int spins = 0; spins < 50'000'000; ++spins) {
+            auto top = reader->read_top(*found);
+            if (top && top->bid_price == 1000 + 999) {
+                _exit(top->bid_quantity == 999 ? 0 : 4);
+            }
+        }
+        _exit(5);
+    }
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        writer->publish_top(slot, TopOfBook{static_cast<Price>(1000 + i), i, 2000, i});
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    assert(WIFEXITED(status));
+    assert(WEXITSTATUS(status) == 0);
+    std::cout << "[OK] Child process read consistent top-of-book\n";
+}
+
+void test_single_writer_per_name() {
+    std::cout << "\n=== Test: Single Writer Per Name ===\n";
+
+    const std::string name = bus_name("owner");
+    auto writer = MarketDataBusWriter::create(name, 2);
+    assert(writer.has_value());
+    [[maybe_unused]] auto slot = writer->add_symbol(1, "AAPL");
+
+    [[maybe_unused]] bool created = MarketDataBusWriter::create(name, 2).has_value();
+    assert(!created);
+    auto reader = MarketDataBusReader::attach(name);
+    assert(reader.has_value() && reader->symbol_count() == 1);
+    std::cout << "[OK] Second writer refused while the owner is alive\n";
+
+    // A writer that dies without its destructor leaves a stale segment behind
+    const std::string stale_name = bus_name("stale");
+    pid_t child = fork();
+    assert(child >= 0);
+    if (child == 0) {
+        auto crashed = MarketDataBusWriter::create(stale_name, 2);
+        _exit(crashed ? 0 : 1);  // _exit skips the destructor's shm_unlink
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    auto replacement = MarketDataBusWriter::create(stale_name, 2);
+    assert(replacement.has_value());
+    std::cout << "[OK] Segment of a dead writer replaced\n";
+}
+
+void test_publish_order_book() {
+    std::cout << "\n=== Test: Publish OrderBook Depth ===\n";
+
+    const std::string name = bus_name("book");
+    auto writer = MarketDataBusWriter::create(name, 1);
+    assert(writer.has_value());
+    uint32_t slot = writer->add_symbol(1, "MSFT").value();
+    auto reader = MarketDataBusReader::attach(name);
+    assert(reader.has_value());
+
+    OrderBook book(1, "MSFT    ");
+    auto add = [&](uint64_t ref, char side, uint32_t shares, uint32_t price) {
+        itch::AddOrder msg{};
+        msg.order_reference = ref;
+        msg.buy_sell_indicator = side;
+        msg.shares = shares;
+        std::memcpy(msg.symbol.data(), "MSFT    ", 8);
+        msg.price = price;
+        book.add_order(msg);
+    };
+    add(1, 'B', 100, 1500000);
+    add(2, 'B', 50, 1499900);
+    add(3, 'B', 25, 1500000);
+    add(4, 'S', 70, 1500500);
+    book.set_last_sequence(42);
+
+    writer->publish(slot, book);
+
+    [[maybe_unused]] auto depth = reader->read_depth(slot);
+    assert(depth.has_value());
+    assert(depth->sequence == 42);
+    assert(depth->bid_count == 2 && depth->ask_count == 1);
+    assert(depth->bids[0].price == 1500000 && depth->bids[0].quantity == 125 && depth->bids[0].order_count == 2);
+    assert(depth->bids[1].price == 1499900 && depth->bids[1].quantity == 50);
+    assert(depth->asks[0].price == 1500500 && depth->asks[0].quantity == 70);
+
+    [[maybe_unused]] auto top = reader->read_top(slot);
+    assert(top.has_value() && top->bid_quantity == 125 && top->ask_price == 1500500);
+    std::cout << "[OK] Depth and top-of-book published from OrderBook\n";
+}
+
+int main() {
+    test_attach_and_discover();
+    test_cross_process_reader();
+    test_single_writer_per_name();
+    test_publish_order_book();
+
+    std::cout << "\nAll market data bus tests passed!\n";
+    return 0;
+}
@@ -3,6 +3,7 @@
 // Comprehensive tests for MoldUDP64 packet parsing and sequence tracking
 
 #include "network/moldudp64.hpp"
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <vector>
@@ -499,6 +500,207 @@ void test_session_id_variations() {
     std::cout << "     Internal spaces preserved (ABCD 1234 stays intact)\n";
 }
 
+void test_session_padding_variants() {
+    std::cout << "\n=== Test: Session Padding Variants ===\n";
+    
+    SequenceTracker tracker;
+    
+    // Space-padded session initializes the tracker
+    auto packet1_data = create_test_packet("PAD", 100, 0, {});
+    auto packet1 = MoldUDP64Packet::parse(packet1_data.data(), packet1_data.size()).value();
+    (void)tracker.process_packet(packet1);
+    
+    // Same session, NUL-padded: raw bytes differ, must NOT be a rollover
+    auto packet2_data = create_test_packet("PAD", 100, 0, {});
+    for (size_t i = 3; i < 10; ++i) {
+        packet2_data[i] = '\0';
+    }
+    auto packet2 = MoldUDP64Packet::parse(packet2_data.data(), packet2_data.size()).value();
+    [[maybe_unused]] auto gap_info = tracker.process_packet(packet2);
+    assert(!gap_info.session_changed);
+    assert(!gap_info.has_gap);
+    assert(tracker.current_session() == "PAD");
+    
+    std::cout << "[OK] Space- and NUL-padded session IDs match\n";
+}
+
+void test_session_fingerprint_adopts_wire_form() {
+    std::cout << "\n=== Test: Session Fingerprint Adopts Wire Form ===\n";
+    
+    using detail::SessionFingerprint;
+    
+    // Known session space-padded (as set_expected_session stores it),
+    // wire session NUL-padded
+    std::array<char, protocol::SESSION_ID_LENGTH> known;
+    known.fill(' ');
+    std::memcpy(known.data(), "PAD", 3);
+    std::array<char, protocol::SESSION_ID_LENGTH> wire{};
+    std::memcpy(wire.data(), "PAD", 3);
+    
+    auto known_fp = SessionFingerprint::from(known);
+    const auto wire_fp = SessionFingerprint::from(wire);
+    assert(!(known_fp == wire_fp));
+    
+    // First packet matches on the slow path and caches the wire fingerprint,
+    // so later packets match on the 8+2-byte compare alone
+    [[maybe_unused]] bool same = detail::same_session(wire_fp, wire, known_fp, known);
+    assert(same);
+    assert(known_fp == wire_fp);
+    
+    // A different session still fails and leaves the cache alone
+    std::array<char, protocol::SESSION_ID_LENGTH> other{};
+    std::memcpy(other.data(), "OTHER", 5);
+    same = detail::same_session(SessionFingerprint::from(other), other, known_fp, known);
+    assert(!same);
+    assert(known_fp == wire_fp);
+    
+    // The original padding still matches (and becomes the cached form)
+    same = detail::same_session(SessionFingerprint::from(known), known, known_fp, known);
+    assert(same);
+    
+    std::cout << "[OK] Padding mismatch pays the trim once, then takes the fast path\n";
+}
+
+void test_expected_session_validation() {
+    std::cout << "\n=== Test: Expected Session Validation ===\n";
+    
+    SequenceTracker tracker;
+    assert(tracker.expected_session().empty());
+    [[maybe_unused]] bool applied = tracker.set_expected_session("TOOLONGSESSION");
+    assert(!applied);
+    applied = tracker.set_expected_session("GOOD000001");
+    assert(applied);
+    assert(tracker.expected_session() == "GOOD000001");
+    
+    // Packet from another session is rejected before initialization
+    std::vector<uint8_t> msg1 = {'S', 0x00, 0x01};
+    auto stale_data = create_test_packet("STALE00001", 1, 1, {msg1});
+    auto stale = MoldUDP64Packet::parse(stale_data.data(), stale_data.size()).value();
+    [[maybe_unused]] auto gap_info = tracker.process_packet(stale);
+    assert(gap_info.session_rejected);
+    assert(!tracker.is_initialized());
+    
+    // Expected session is accepted
+    auto good_data = create_test_packet("GOOD000001", 50, 1, {msg1});
+    auto good = MoldUDP64Packet::parse(good_data.data(), good_data.size()).value();
+    gap_info = tracker.process_packet(good);
+    assert(!gap_info.session_rejected);
+    assert(tracker.expected_sequence() == 51);
+    
+    // Another session after initialization: rejected, not treated as rollover
+    gap_info = tracker.process_packet(stale);
+    assert(gap_info.session_rejected);
+    assert(!gap_info.session_changed);
+    assert(tracker.current_session() == "GOOD000001");
+    assert(tracker.expected_sequence() == 51);
+    
+    // Short expected IDs are padded, so they match space-padded packets
+    applied = tracker.set_expected_session("STALE00001");
+    assert(applied);
+    gap_info = tracker.process_packet(stale);
+    assert(gap_info.session_changed);
+    
+    // reset() keeps configuration; clear_expected_session() removes it
+    tracker.reset();
+    assert(tracker.expected_session() == "STALE00001");
+    tracker.clear_expected_session();
+    gap_info = tracker.process_packet(good);
+    assert(!gap_info.session_rejected);
+    
+    std::cout << "[OK] Packets from unexpected sessions are rejected\n";
+}
+
+void test_packet_view_matches_vector_parse() {
+    std::cout << "\n=== Test: Packet View Matches Vector Parse ===\n";
+    
+    std::vector<uint8_t> msg1 = {'S', 0x00, 0x01};
+    std::vector<uint8_t> msg2 = {'A', 0x00, 0x02, 0x00, 0x03};
+    std::vector<uint8_t> msg3 = {'E', 0x00, 0x04};
+    auto packet_data = create_test_packet("VIEW000001", 500, 3, {msg1, msg2, msg3});
+    
+    auto packet = MoldUDP64Packet::parse(packet_data.data(), packet_data.size()).value();
+    auto view = MoldUDP64PacketView::parse(packet_data.data(), packet_data.size()).value();
+    
+    assert(view.size() == 3);
+    assert(view.first_sequence() == 500);
+    assert(view.last_sequence() == 502);
+    
+    // Iteration yields the same blocks, pointing into the same buffer
+    size_t i = 0;
+    for ([[maybe_unused]] MessageBlock block : view) {
+        assert(block.length == packet.messages[i].length);
+        assert(block.data == packet.messages[i].data);
+        assert(block.sequence == packet.messages[i].sequence);
+        ++i;
+    }
+    assert(i == 3);
+    
+    // Heartbeat view is valid and empty
+    auto hb_data = create_test_packet("VIEW000001", 503, 0, {});
+    [[maybe_unused]] auto hb = MoldUDP64PacketView::parse(hb_data.data(), hb_data.size()).value();
+    assert(hb.is_heartbeat());
+    assert(hb.empty());
+    assert(hb.begin() == hb.end());
+    
+    std::cout << "[OK] View iteration matches vector parse\n";
+}
+
+void test_packet_view_rejects_malformed() {
+    std::cout << "\n=== Test: Packet View Rejects Malformed ===\n";
+    
+    std::vector<uint8_t> msg1 = {'S', 0x00, 0x01, 0x00, 0x02};
+    auto truncated = create_test_packet("VIEWBAD001", 300, 1, {msg1});
+    truncated.resize(truncated.size() - 2);
+    assert(!MoldUDP64PacketView::parse(truncated.data(), truncated.size()).has_value());
+    
+    auto excessive = create_test_packet("VIEWBAD001", 400, 200, {});
+    assert(!MoldUDP64PacketView::parse(excessive.data(), excessive.size()).has_value());
+    
+    MoldUDP64InlinePacket inline_packet;
+    [[maybe_unused]] const bool truncated_ok = inline_packet.parse(truncated.data(), truncated.size());
+    assert(!truncated_ok);
+    [[maybe_unused]] const bool excessive_ok = inline_packet.parse(excessive.data(), excessive.size());
+    assert(!excessive_ok);
+    
+    std::cout << "[OK] View and inline packet reject malformed packets\n";
+}
+
+void test_inline_packet_random_access() {
+    std::cout << "\n=== Test: Inline Packet Random Access ===\n";
+    
+    std::vector<uint8_t> msg1 = {'S', 0x00, 0x01};
+    std::vector<uint8_t> msg2 = {'A', 0x00, 0x02, 0x00, 0x03};
+    auto packet_data = create_test_packet("INLINE0001", 700, 2, {msg1, msg2});
+    
+    MoldUDP64InlinePacket packet;
+    [[maybe_unused]] bool parsed = packet.parse(packet_data.data(), packet_data.size());
+    assert(parsed);
+    assert(packet.size() == 2);
+    assert(packet[1].length == 5);
+    assert(packet[1].data[0] == 'A');
+    assert(packet[1].sequence == 701);
+    
+    // Reuse the same object for a heartbeat: previous blocks are dropped
+    auto hb_data = create_test_packet("INLINE0001", 702, 0, {});
+    parsed = packet.parse(hb_data.data(), hb_data.size());
+    assert(parsed);
+    assert(packet.is_heartbeat());
+    assert(packet.empty());
+    
+    // Tracker accepts all packet representations
+    SequenceTracker tracker;
+    parsed = packet.parse(packet_data.data(), packet_data.size());
+    assert(parsed);
+    [[maybe_unused]] auto inline_gap = tracker.process_packet(packet);
+    assert(!inline_gap.has_gap);
+    auto view = MoldUDP64PacketView::parse(hb_data.data(), hb_data.size()).value();
+    [[maybe_unused]] auto view_gap = tracker.process_packet(view);
+    assert(!view_gap.has_gap);
+    assert(tracker.expected_sequence() == 702);
+    
+    std::cout << "[OK] Inline packet supports random access and reuse\n";
+}
+
 int main() {
     try {
         std::cout << "================================================\n";
@@ -534,6 +736,14 @@ int main() {
 
         // Edge cases
         test_session_id_variations();
+        test_session_padding_variants();
+        test_session_fingerprint_adopts_wire_form();
+        test_expected_session_validation();
+
+        // Zero-allocation packet representations
+        test_packet_view_matches_vector_parse();
+        test_packet_view_rejects_malformed();
+        test_inline_packet_random_access();
 
         std::cout << "\n================================================\n";
         std::cout << "[PASS] ALL MOLDUDP64 TESTS PASSED!\n";
@@ -0,0 +1,278 @@
+// tests/test_topology.cpp
+//
+// Tests for NUMA topology detection, thread pinning and node-bound memory.
+// Multi-node cases use a fake sysfs tree, so they run on single-node boxes.
+
+#include "common/topology.hpp"
+#include "common/mapped_memory.hpp"
+#include "book/order_book.hpp"
+#include "itch/messages.hpp"
+#include "numa_placement.hpp"  // 02_ring_buffer: make_on_node() lookups
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace hft;
+namespace fs = std::filesystem;
+
+/// Throwaway sysfs-like tree: write_file("node/node0/cpulist", "0-3")
+class FakeSysfs {
+public:
+    FakeSysfs() : root_(fs::temp_directory_path() /
+                        ("fake_sysfs_" + std::to_string(::getpid()) + "_" + std::to_string(next_id_++))) {
+        fs::remove_all(root_);
+        fs::create_directories(root_);
+    }
+    ~FakeSysfs() { fs::remove_all(root_); }
+
+    void write_file(const std::string& relative, const std::string& content) const {
+        const fs::path path = root_ / relative;
+        fs::create_directories(path.parent_path());
+        std::ofstream(path) << content << "\n";
+    }
+
+    const fs::path& root() const { return root_; }
+
+private:
+    static inline int next_id_ = 0;
+    fs::path root_;
+};
+
+/// Memory policy governing `address`, as set by mbind()
+struct PagePolicy {
+    int mode = -1;            // MPOL_*; -1 if the kernel has no NUMA support
+    unsigned long nodes = 0;  // Node mask the mode applies to
+};
+
+PagePolicy page_policy(const void* address) {
+    PagePolicy policy;
+#if defined(__linux__)
+    int mode = 0;
+    unsigned long nodes = 0;
+    if (::syscall(SYS_get_mempolicy, &mode, &nodes, sizeof(nodes) * 8, address, MPOL_F_ADDR) == 0) {
+        policy = {mode, nodes};
+    }
+#endif
+    (void)address;
+    return policy;
+}
+
+void test_parse_cpulist() {
+    std::cout << "\n=== Test: CPU List Parsing ===\n";
+
+    assert(Topology::parse_cpulist("0-3") == (std::vector<int>{0, 1, 2, 3}));
+    assert(Topology::parse_cpulist("0-1,8,10-11") == (std::vector<int>{0, 1, 8, 10, 11}));
+    assert(Topology::parse_cpulist("5") == (std::vector<int>{5}));
+    assert(Topology::parse_cpulist("").empty());
+    std::cout << "[OK] Ranges, singles and empty lists\n";
+}
+
+void test_fake_two_node_topology() {
+    std::cout << "\n=== Test: Fake Dual-Socket Topology ===\n";
+
+    FakeSysfs sysfs;
+    sysfs.write_file("node/node0/cpulist", "0-3");
+    sysfs.write_file("node/node1/cpulist", "4-7");
+    sysfs.write_file("node/node2/cpulist", "");  // Memory-only (e.g. CXL)
+    sysfs.write_file("node/possible", "0-2");     // Not a node directory
+    sysfs.write_file("cpu/online", "0-7");
+
+    const auto topology = Topology::detect(sysfs.root(), {});
+    assert(topology.is_numa() && topology.node_count() == 2);
+    assert(topology.nodes()[1].id == 1 && topology.nodes()[1].cpus.size() == 4);
+    assert(topology.node_of_cpu(2) == 0 && topology.node_of_cpu(5) == 1);
+    assert(topology.node_of_cpu(42) == ANY_NUMA_NODE);
+    std::cout << "[OK] Two CPU nodes found, memory-only node skipped\n";
+
+    // Highest CPUs first, wrapping when the node runs out
+    assert(topology.assign_cpus(1, 3) == (std::vector<int>{7, 6, 5}));
+    assert(topology.assign_cpus(1, 6) == (std::vector<int>{7, 6, 5, 4, 7, 6}));
+    assert(topology.assign_cpus(9, 1) == (std::vector<int>{3}));  // Unknown node -> first
+    std::cout << "[OK] Pipeline threads get distinct CPUs on the requested node\n";
+}
+
+void test_affinity_mask() {
+    std::cout << "\n=== Test: Affinity Mask Limits CPUs ===\n";
+
+    FakeSysfs sysfs;
+    sysfs.write_file("node/node0/cpulist", "0-3");
+    sysfs.write_file("node/node1/cpulist", "4-7");
+    sysfs.write_file("cpu/online", "0-7");
+
+    // e.g. taskset -c 1,2,6
+    const auto topology = Topology::detect(sysfs.root(), {1, 2, 6});
+    assert(topology.node_count() == 2);
+    assert(topology.nodes()[0].cpus == (std::vector<int>{1, 2}));
+    assert(topology.assign_cpus(0, 3) == (std::vector<int>{2, 1, 2}));
+    assert(topology.assign_cpus(1, 1) == (std::vector<int>{6}));
+    std::cout << "[OK] Only CPUs in the mask are assigned\n";
+
+    // No usable CPU on node 1: dropped, requests fall back to node 0
+    const auto one_node = Topology::detect(sysfs.root(), {0, 3});
+    assert(one_node.node_count() == 1);
+    assert(one_node.assign_cpus(1, 1) == (std::vector<int>{3}));
+
+    FakeSysfs no_nodes;
+    no_nodes.write_file("cpu/online", "0-7");
+    assert(Topology::detect(no_nodes.root(), {5}).nodes()[0].cpus == (std::vector<int>{5}));
+    std::cout << "[OK] Nodes outside the mask dropped\n";
+
+    // The real mask: every assigned CPU can actually be pinned
+    const auto allowed = Topology::allowed_cpus();
+    for ([[maybe_unused]] int cpu : Topology::detect().assign_cpus(0, 4)) {
+        assert(allowed.empty() || std::find(allowed.begin(), allowed.end(), cpu) != allowed.end());
+    }
+    std::cout << "[OK] Detected topology respects this process's mask (" << allowed.size() << " CPUs)\n";
+}
+
+void test_fallback_without_numa() {
+    std::cout << "\n=== Test: Fallback Without NUMA Sysfs ===\n";
+
+    FakeSysfs no_nodes;
+    no_nodes.write_file("cpu/online", "0-1");
+    const auto single = Topology::detect(no_nodes.root(), {});
+    assert(!single.is_numa());
+    assert(single.nodes()[0].id == 0 && single.nodes()[0].cpus == (std::vector<int>{0, 1}));
+    std::cout << "[OK] No node directory: one node with the online CPUs\n";
+
+    FakeSysfs empty;
+    const auto bare = Topology::detect(empty.root(), {});
+    assert(bare.node_count() == 1 && !bare.nodes()[0].cpus.empty());
+    assert(Topology({}).node_count() == 1);
+    std::cout << "[OK] Nothing readable: one node with hardware_concurrency CPUs\n";
+}
+
+void test_system_lookup() {
+    std::cout << "\n=== Test: Shared CPU -> Node Lookup ===\n";
+
+    // system() ignores the affinity mask, so it knows every CPU detect() keeps
+    const auto& system = Topology::system();
+    const auto detected = Topology::detect();
+    for (const auto& node : detected.nodes()) {
+        for ([[maybe_unused]] int cpu : node.cpus) {
+            assert(system.node_of_cpu(cpu) == node.id);
+            // Ring placement resolves nodes through the same table
+            assert(core::numa_node_of_cpu(static_cast<unsigned>(cpu)) == node.id);
+        }
+    }
+    assert(&Topology::system() == &system);
+    std::cout << "[OK] " << system.node_count() << " node(s); ring placement agrees with Topology\n";
+}
+
+void test_pinning() {
+    std::cout << "\n=== Test: Thread Pinning ===\n";
+
+    const auto topology = Topology::detect();
+    const int cpu = topology.assign_cpus(0, 1).front();
+
+    int seen_cpu = -1;
+    int seen_node = ANY_NUMA_NODE;
+    [[maybe_unused]] int ring_node = ANY_NUMA_NODE;
+    std::thread worker = Topology::start_pinned(cpu, [&] {
+        seen_cpu = sched_getcpu();
+        seen_node = topology.current_node();
+        ring_node = core::current_numa_node();
+    });
+    worker.join();
+    assert(seen_cpu == cpu);
+    assert(seen_node == topology.node_of_cpu(cpu));
+    assert(ring_node == seen_node);
+    std::cout << "[OK] start_pinned() runs on CPU " << seen_cpu << " (node " << seen_node << ")\n";
+
+    // CPUs the process cannot use are refused, not fatal
+    [[maybe_unused]] bool pinned = Topology::pin_current_thread(-1);
+    assert(!pinned);
+    pinned = Topology::pin_current_thread(100000);
+    assert(!pinned);
+    std::cout << "[OK] Pinning to a non-existent CPU returns false\n";
+}
+
+void test_node_bound_memory() {
+    std::cout << "\n=== Test: Node-Bound Memory ===\n";
+
+    // Owning thread's node on this machine
+    const auto topology = Topology::detect();
+    const int local = topology.current_node();
+    [[maybe_unused]] int stack_probe = 0;
+    const bool numa_kernel = page_policy(&stack_probe).mode >= 0;
+
+    MappedRegion region(4 * MappedRegion::HUGE_PAGE_SIZE, {HugePages::TRANSPARENT, true, false, local});
+    [[maybe_unused]] const PagePolicy policy = page_policy(region.data());
+    if (numa_kernel && local != ANY_NUMA_NODE) {
+        // Single-node boxes included: the preferred-node policy is still recorded
+        assert(region.numa_node() == local);
+        assert(policy.mode == MPOL_PREFERRED && policy.nodes == (1UL << local));
+        std::cout << "[OK] Region bound to node " << local << " (MPOL_PREFERRED)\n";
+    } else {
+        assert(region.numa_node() == ANY_NUMA_NODE && policy.mode != MPOL_PREFERRED);
+        std::cout << "[OK] Kernel without NUMA support: region left to first touch\n";
+    }
+
+    // A node this machine does not have (node 1 of the fake dual-socket box)
+    if (topology.node_count() == 1) {
+        MappedRegion remote(MappedRegion::HUGE_PAGE_SIZE, {HugePages::EXPLICIT, true, false, 1});
+        assert(remote.numa_node() == ANY_NUMA_NODE);
+        assert(page_policy(remote.data()).mode != MPOL_PREFERRED);
+        std::memset(remote.data(), 0x5A, remote.size());
+        std::cout << "[OK] Missing node degrades to first-touch placement\n";
+    }
+
+    // Allocator carries the node to every large allocation
+    MappedAllocator<PriceLevel> allocator({HugePages::TRANSPARENT, true, false, local});
+    const size_t levels = MappedRegion::HUGE_PAGE_SIZE / sizeof(PriceLevel);
+    PriceLevel* ladder = allocator.allocate(levels);
+    ladder[levels - 1].quantity = 1;
+    [[maybe_unused]] const PagePolicy ladder_policy = page_policy(ladder);
+    assert(ladder_policy.mode == policy.mode && ladder_policy.nodes == policy.nodes);
+    allocator.deallocate(ladder, levels);
+    std::cout << "[OK] MappedAllocator places ladders on the requested node\n";
+}
+
+void test_node_bound_order_book() {
+    std::cout << "\n=== Test: OrderBook on the Owning Thread's Node ===\n";
+
+    const auto topology = Topology::detect();
+    const int cpu = topology.assign_cpus(0, 1).front();
+
+    TopOfBook top{};
+    std::thread book_thread = Topology::start_pinned(cpu, [&] {
+        BackingOptions backing{HugePages::TRANSPARENT, false, false, topology.current_node()};
+        OrderBook book(1, "AAPL    ", backing, 1024);
+
+        itch::AddOrder msg{};
+        msg.order_reference = 1;
+        msg.buy_sell_indicator = 'B';
+        msg.shares = 300;
+        std::memcpy(msg.symbol.data(), "AAPL    ", 8);
+        msg.price = 1'500'000;
+        book.add_order(msg);
+        top = book.get_top_of_book();
+    });
+    book_thread.join();
+    assert(top.bid_price == 1'500'000 && top.bid_quantity == 300);
+    std::cout << "[OK] Book built and updated on its pinned owner thread\n";
+}
+
+int main() {
+    test_parse_cpulist();
+    test_fake_two_node_topology();
+    test_affinity_mask();
+    test_fallback_without_numa();
+    test_system_lookup();
+    test_pinning();
+    test_node_bound_memory();
+    test_node_bound_order_book();
+
+    std::cout << "\nAll topology tests passed!\n";
+    return 0;
+}